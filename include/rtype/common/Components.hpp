@@ -2,6 +2,8 @@
 
 #include <chrono>
 #include "Types.hpp"
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <vector>
 namespace rtype
@@ -102,13 +104,47 @@ struct TeamComponent
     Team team{Team::Player};
 };
 
+/**
+ * @brief What a hitbox or hurtbox belongs to, for the [CollisionLayers] matrix
+ */
+enum class CollisionLayer : std::uint8_t
+{
+    Player,
+    PlayerBullet,
+    Monster,
+    MonsterBullet,
+    Neutral,
+    NeutralBullet,
+    PowerUp,
+    MonsterShield,  ///< Shield of a Monster-team monster
+    NeutralShield,  ///< Shield of a Neutral-team monster
+    Count,
+};
+
+constexpr std::size_t kCollisionLayerCount = static_cast<std::size_t>(CollisionLayer::Count);
+
+/// Bit of a layer in a layer mask
+constexpr std::uint32_t layerBit(CollisionLayer layer)
+{
+    return std::uint32_t{1} << static_cast<unsigned>(layer);
+}
+
 struct Hurtbox {
     std::optional<EntityId> collidedWith{};
+    CollisionLayer layer{CollisionLayer::Monster};
 };
 
 struct Hitbox
 {
     bool destroyOnHit = true;
+    CollisionLayer layer{CollisionLayer::PlayerBullet};
+};
+
+/// Where a circle hitbox was when CollisionSystem last tested it, for swept tests
+struct PreviousTransform
+{
+    float x{0.0f};
+    float y{0.0f};
 };
 
 struct Collider {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "rtype/common/Types.hpp"
+#include <array>
 #include <string>
 #include <cstdint>
 #include <unordered_map>
@@ -148,6 +149,8 @@ struct NetworkConfig
     std::size_t rxBufferSize{1024};
     float serverTimeout{5.0f};
     float clientTimeout{10.0f};
+    float statsDumpInterval{0.0f};  // Seconds between registry stats dumps (0 = off)
+    std::string profileCsvPath;     // File system timings are appended to on each dump (empty = off)
 };
 
 struct AudioConfig
@@ -166,17 +169,73 @@ struct FontConfig
     std::string font_filename;
 };
 
+struct SystemRateConfig
+{
+    std::uint32_t divisor{1};  // Run once every divisor ticks
+    std::int64_t phase{-1};    // Tick offset within the divisor (-1 = spread automatically)
+};
+
+/**
+ * @brief Which hurtbox layers each hitbox layer can hit ([CollisionLayers])
+ *
+ * Rows are indexed by hitbox layer and hold a layerBit() mask of the
+ * hurtbox layers it hits. The defaults keep players, monsters and neutrals
+ * from hurting their own side, shields included (a shield takes the layer
+ * of its monster's team); FriendlyFire lets player bullets hit players.
+ * The Player row also decides whether players pick up power-ups.
+ */
+struct CollisionMatrix
+{
+    std::array<std::uint32_t, kCollisionLayerCount> hits{};
+
+    bool collides(CollisionLayer hitbox, CollisionLayer hurtbox) const
+    {
+        return (hits[static_cast<std::size_t>(hitbox)] & layerBit(hurtbox)) != 0;
+    }
+
+    void allow(CollisionLayer hitbox, CollisionLayer hurtbox, bool allowed = true)
+    {
+        std::uint32_t &row = hits[static_cast<std::size_t>(hitbox)];
+        row = allowed ? (row | layerBit(hurtbox)) : (row & ~layerBit(hurtbox));
+    }
+
+    static CollisionMatrix defaults()
+    {
+        CollisionMatrix matrix;
+        const auto row = [&matrix](CollisionLayer layer) -> std::uint32_t & { return matrix.hits[static_cast<std::size_t>(layer)]; };
+        row(CollisionLayer::Player) = layerBit(CollisionLayer::PowerUp);
+        const std::uint32_t monsterSide = layerBit(CollisionLayer::Monster) | layerBit(CollisionLayer::MonsterShield);
+        const std::uint32_t neutralSide = layerBit(CollisionLayer::Neutral) | layerBit(CollisionLayer::NeutralShield);
+        row(CollisionLayer::PlayerBullet) = monsterSide | neutralSide;
+        row(CollisionLayer::Monster) = layerBit(CollisionLayer::Player) | neutralSide;
+        row(CollisionLayer::MonsterBullet) = layerBit(CollisionLayer::Player) | neutralSide;
+        row(CollisionLayer::Neutral) = layerBit(CollisionLayer::Player) | monsterSide;
+        row(CollisionLayer::NeutralBullet) = layerBit(CollisionLayer::Player) | monsterSide;
+        return matrix;
+    }
+};
+
 struct SystemsConfig
 {
     bool movementSystem{true};
     bool fireCooldownSystem{true};
     bool projectileLifetimeSystem{true};
+    bool fusedProjectiles{false}; // Age and cull projectiles in one ProjectileSystem pass (slower so far, see rtype_projectile_bench)
     bool collisionSystem{true};
     bool boundarySystem{true};
     bool cleanupSystem{true};
     bool monsterSpawnerSystem{true};
     bool levelSystem{false};
     float boundaryMargin{100.0f};
+    std::size_t workerThreads{0};  // Threads running independent systems in parallel (0 = sequential)
+    bool profileSystems{true};     // Time every system update into latency histograms
+    bool fixedTimestep{true};      // Simulate in fixed ticks of 1 / tickRate seconds (false = raw frame dt)
+    float tickRate{60.0f};         // Simulation ticks per second
+    std::size_t maxSubsteps{5};    // Most ticks caught up in one frame before dropping time
+    bool staticPipeline{false};    // Run the compile-time pipeline (no virtual dispatch, sequential only)
+    std::string simdKernels{"auto"};  // Kernel instruction set: auto (best detected), scalar, sse4.2, avx2 or avx512
+    std::unordered_map<std::string, SystemRateConfig> rates;  // [SystemRates] overrides, keyed by system class name
+    CollisionMatrix collisionLayers{CollisionMatrix::defaults()};  // [CollisionLayers] rows, before FriendlyFire is applied
 };
 
 class GameConfig
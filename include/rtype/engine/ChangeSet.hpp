@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** ChangeSet - Entities whose component was touched since the last clear
+*/
+
+#pragma once
+
+#include "rtype/common/Types.hpp"
+#include "rtype/engine/Entity.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace rtype::engine
+{
+
+/**
+ * @brief Deduplicated list of entities touched since the last clear
+ *
+ * A per-slot marker holding the handle that was marked keeps mark() O(1)
+ * and idempotent; the list keeps the order of first touch. Clearing only
+ * visits the entries that were actually marked.
+ */
+class ChangeSet
+{
+public:
+    explicit ChangeSet(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : _entities(resource), _marked(resource)
+    {
+    }
+
+    void mark(EntityId id)
+    {
+        const std::uint32_t slot = entityIndex(id);
+        if (slot >= _marked.size())
+            _marked.resize(static_cast<std::size_t>(slot) + 1, kNullEntity);
+
+        if (_marked[slot] == id)
+            return;
+
+        _marked[slot] = id;
+        _entities.push_back(id);
+    }
+
+    bool contains(EntityId id) const
+    {
+        const std::uint32_t slot = entityIndex(id);
+        return slot < _marked.size() && _marked[slot] == id && id != kNullEntity;
+    }
+
+    /// Touched entities, in first-touch order (may include since-destroyed ones)
+    const std::pmr::vector<EntityId> &entities() const { return _entities; }
+
+    std::size_t size() const { return _entities.size(); }
+
+    void clear()
+    {
+        for (EntityId id : _entities)
+            _marked[entityIndex(id)] = kNullEntity;
+        _entities.clear();
+    }
+
+private:
+    std::pmr::vector<EntityId> _entities;
+    std::pmr::vector<EntityId> _marked;
+};
+
+}
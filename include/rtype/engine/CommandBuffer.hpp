@@ -0,0 +1,179 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** CommandBuffer - Structural changes deferred while the Registry is iterated
+*/
+
+#pragma once
+
+#include "rtype/common/Types.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace rtype::engine
+{
+
+class Registry;
+
+/**
+ * @brief Records add/remove/destroy requests issued while storages are walked
+ *
+ * While any forEach/view/group iteration is running, the Registry routes
+ * structural changes here instead of touching the storages, so iteration can
+ * walk the dense arrays in place. When the outermost iteration returns, the
+ * commands are replayed in the order they were recorded (the sync point).
+ * Entity creation is not deferred: createEntity only reserves a handle and
+ * never moves component data, so new ids are usable right away.
+ *
+ * Commands are constructed back to back in blocks of kBlockSize bytes taken
+ * from the registry memory resource. Blocks and the command list are kept
+ * from one sync point to the next, so recording a command is a bump of an
+ * offset and a steady game loop allocates nothing once warmed up.
+ *
+ * The iteration depth is atomic so that non-structural systems run in
+ * parallel by the SystemPipeline can iterate the same registry at once;
+ * recording commands is still single-threaded.
+ */
+class CommandBuffer
+{
+public:
+    static constexpr std::size_t kBlockSize = 16 * 1024;
+
+    CommandBuffer(Registry &registry, std::pmr::memory_resource *resource)
+        : _registry(registry), _resource(resource), _commands(resource), _blocks(resource)
+    {
+    }
+
+    ~CommandBuffer();
+
+    CommandBuffer(const CommandBuffer &) = delete;
+    CommandBuffer &operator=(const CommandBuffer &) = delete;
+
+    /**
+     * @brief RAII marker for one (possibly nested) iteration
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(CommandBuffer &buffer) : _buffer(buffer) { _buffer._depth.fetch_add(1, std::memory_order_relaxed); }
+        ~Scope() { _buffer.leave(); }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        CommandBuffer &_buffer;
+    };
+
+    /// True while at least one iteration is running
+    bool deferring() const { return _depth.load(std::memory_order_relaxed) > 0; }
+
+    bool empty() const { return _commands.empty(); }
+    std::size_t size() const { return _commands.size(); }
+
+    /**
+     * @brief Queue a component insertion
+     * @return Reference to the buffered component, valid until the sync point
+     */
+    template <typename Component>
+    Component &add(EntityId id, Component &&component)
+    {
+        return record<AddCommand<Component>>(id, std::move(component)).component;
+    }
+
+    template <typename Component>
+    void remove(EntityId id)
+    {
+        record<RemoveCommand<Component>>(id);
+    }
+
+    void destroy(EntityId id)
+    {
+        record<DestroyCommand>(id);
+    }
+
+    /**
+     * @brief Replay every queued command against the registry, then clear
+     *
+     * Commands targeting an entity destroyed in the meantime are dropped.
+     */
+    void flush();
+
+private:
+    struct Command
+    {
+        explicit Command(EntityId target) : id(target) {}
+        virtual ~Command() = default;
+        virtual void apply(Registry &registry) = 0;
+
+        EntityId id;
+    };
+
+    template <typename Component>
+    struct AddCommand : Command
+    {
+        AddCommand(EntityId target, Component &&value) : Command(target), component(std::move(value)) {}
+        void apply(Registry &registry) override;
+
+        Component component;
+    };
+
+    template <typename Component>
+    struct RemoveCommand : Command
+    {
+        using Command::Command;
+        void apply(Registry &registry) override;
+    };
+
+    struct DestroyCommand : Command
+    {
+        using Command::Command;
+        void apply(Registry &registry) override;
+    };
+
+    struct Block
+    {
+        std::byte *data;
+        std::size_t size;
+    };
+
+    /// Construct a command in the blocks and queue it
+    template <typename CommandType, typename... Args>
+    CommandType &record(Args &&...args)
+    {
+        static_assert(alignof(CommandType) <= alignof(std::max_align_t), "CommandBuffer: blocks are only max_align_t aligned");
+        void *memory = allocate(sizeof(CommandType), alignof(CommandType));
+        CommandType *command = ::new (memory) CommandType(std::forward<Args>(args)...);
+        _commands.push_back(command);
+        return *command;
+    }
+
+    /// Bump-allocate from the current block, moving to the next (kept or new) one when full
+    void *allocate(std::size_t size, std::size_t alignment);
+
+    /// Destroy every queued command and rewind the blocks for reuse
+    void release();
+
+    void leave()
+    {
+        if (_depth.fetch_sub(1, std::memory_order_acq_rel) == 1 && !_commands.empty())
+            flush();
+    }
+
+    Registry &_registry;
+    std::pmr::memory_resource *_resource;
+    std::pmr::vector<Command *> _commands;
+    std::pmr::vector<Block> _blocks;
+    std::size_t _block{0};   ///< Block being filled
+    std::size_t _offset{0};  ///< First free byte in it
+    std::atomic<int> _depth{0};
+};
+
+}
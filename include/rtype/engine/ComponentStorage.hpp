@@ -0,0 +1,408 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** ComponentStorage - Sparse-set backend used by the Registry
+*/
+
+#pragma once
+
+#include "rtype/common/Types.hpp"
+#include "rtype/engine/Entity.hpp"
+#include "rtype/engine/RegistryStats.hpp"
+#include "rtype/engine/StoragePolicy.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace rtype::engine
+{
+
+/**
+ * @brief Type-erased interface so the Registry can manage every storage
+ */
+struct IComponentStorage
+{
+    virtual ~IComponentStorage() = default;
+    virtual void removeEntity(EntityId id) = 0;
+    virtual bool hasEntity(EntityId id) const = 0;
+    virtual std::size_t count() const = 0;
+
+    /**
+     * @brief Occupancy and memory of this storage (typeId is filled by the Registry)
+     */
+    virtual StorageStats stats() const = 0;
+};
+
+/**
+ * @brief Storage for a specific component type
+ *
+ * The backend is picked at compile time from StoragePolicy<Component>. All
+ * backends share the same interface: emplace/removeEntity/hasEntity/find,
+ * entities() listing owners in slot order, at(slot) returning the matching
+ * component, and index/swapSlots so groups can keep members packed.
+ */
+template <typename Component, typename Policy = StoragePolicyOf<Component>>
+class ComponentStorage;
+
+/**
+ * @brief Sparse-set storage (DenseStorage policy)
+ *
+ * Components live in a dense array, with a parallel dense array holding the
+ * owning entity of each slot. A sparse array indexed by entity slot
+ * (entityIndex(id)) maps an entity to its dense slot, so lookups are two
+ * array loads and iteration walks contiguous memory. The dense entity array
+ * keeps full handles, which rejects stale generations. Removal swaps the
+ * last element into the freed slot.
+ *
+ * All three arrays allocate from the memory resource given at construction.
+ */
+template <typename Component>
+class ComponentStorage<Component, DenseStorage> : public IComponentStorage
+{
+public:
+    explicit ComponentStorage(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : _dense(resource), _entities(resource), _sparse(resource)
+    {
+    }
+
+    /**
+     * @brief Insert or overwrite the component of an entity
+     * @return Reference to the stored component (invalidated by later inserts)
+     */
+    Component &emplace(EntityId id, Component &&component)
+    {
+        if (Component *existing = find(id))
+        {
+            *existing = std::move(component);
+            return *existing;
+        }
+
+        const std::uint32_t slot = entityIndex(id);
+        if (slot >= _sparse.size())
+            _sparse.resize(static_cast<std::size_t>(slot) + 1, kInvalidIndex);
+
+        _sparse[slot] = static_cast<std::uint32_t>(_dense.size());
+        _entities.push_back(id);
+        _dense.push_back(std::move(component));
+        return _dense.back();
+    }
+
+    void removeEntity(EntityId id) override
+    {
+        if (!hasEntity(id))
+            return;
+
+        const std::uint32_t index = _sparse[entityIndex(id)];
+        const std::uint32_t last = static_cast<std::uint32_t>(_dense.size() - 1);
+
+        if (index != last)
+        {
+            _dense[index] = std::move(_dense[last]);
+            _entities[index] = _entities[last];
+            _sparse[entityIndex(_entities[index])] = index;
+        }
+
+        _dense.pop_back();
+        _entities.pop_back();
+        _sparse[entityIndex(id)] = kInvalidIndex;
+    }
+
+    bool hasEntity(EntityId id) const override
+    {
+        const std::uint32_t slot = entityIndex(id);
+        return slot < _sparse.size() && _sparse[slot] != kInvalidIndex && _entities[_sparse[slot]] == id;
+    }
+
+    std::size_t count() const override
+    {
+        return _dense.size();
+    }
+
+    StorageStats stats() const override
+    {
+        StorageStats stats;
+        stats.typeName = typeid(Component).name();
+        stats.backend = "dense";
+        stats.count = _dense.size();
+        stats.capacity = _dense.capacity();
+        stats.sparseSize = _sparse.size();
+        accumulateBytes(_dense, stats.bytesUsed, stats.bytesReserved);
+        accumulateBytes(_entities, stats.bytesUsed, stats.bytesReserved);
+        accumulateBytes(_sparse, stats.bytesUsed, stats.bytesReserved);
+        return stats;
+    }
+
+    Component *find(EntityId id)
+    {
+        return hasEntity(id) ? &_dense[_sparse[entityIndex(id)]] : nullptr;
+    }
+
+    const Component *find(EntityId id) const
+    {
+        return hasEntity(id) ? &_dense[_sparse[entityIndex(id)]] : nullptr;
+    }
+
+    Component &at(std::size_t slot) { return _dense[slot]; }
+    const Component &at(std::size_t slot) const { return _dense[slot]; }
+
+    /**
+     * @brief Dense slot of an entity (only meaningful when hasEntity(id))
+     */
+    std::size_t index(EntityId id) const
+    {
+        return _sparse[entityIndex(id)];
+    }
+
+    /**
+     * @brief Exchange two dense slots, keeping the sparse index in sync
+     *
+     * Used by owning groups to keep their members packed at the front.
+     */
+    void swapSlots(std::size_t a, std::size_t b)
+    {
+        if (a == b)
+            return;
+
+        std::swap(_dense[a], _dense[b]);
+        std::swap(_entities[a], _entities[b]);
+        _sparse[entityIndex(_entities[a])] = static_cast<std::uint32_t>(a);
+        _sparse[entityIndex(_entities[b])] = static_cast<std::uint32_t>(b);
+    }
+
+    /// Dense array of owning entities, in the same order as components()
+    const std::pmr::vector<EntityId> &entities() const { return _entities; }
+
+    std::pmr::vector<Component> &components() { return _dense; }
+    const std::pmr::vector<Component> &components() const { return _dense; }
+
+private:
+    static constexpr std::uint32_t kInvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    std::pmr::vector<Component> _dense;
+    std::pmr::vector<EntityId> _entities;
+    std::pmr::vector<std::uint32_t> _sparse;
+};
+
+/**
+ * @brief Flat storage for rare components (SmallMapStorage policy)
+ *
+ * Owners and values sit in two short parallel arrays searched linearly.
+ * There is no sparse index, so a component carried by one or two entities
+ * costs nothing per entity slot of the registry.
+ */
+template <typename Component>
+class ComponentStorage<Component, SmallMapStorage> : public IComponentStorage
+{
+public:
+    explicit ComponentStorage(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : _values(resource), _entities(resource)
+    {
+    }
+
+    Component &emplace(EntityId id, Component &&component)
+    {
+        if (Component *existing = find(id))
+        {
+            *existing = std::move(component);
+            return *existing;
+        }
+
+        _entities.push_back(id);
+        _values.push_back(std::move(component));
+        return _values.back();
+    }
+
+    void removeEntity(EntityId id) override
+    {
+        const std::size_t slot = index(id);
+        if (slot == _entities.size())
+            return;
+
+        if (slot != _entities.size() - 1)
+        {
+            _values[slot] = std::move(_values.back());
+            _entities[slot] = _entities.back();
+        }
+        _values.pop_back();
+        _entities.pop_back();
+    }
+
+    bool hasEntity(EntityId id) const override
+    {
+        return index(id) != _entities.size();
+    }
+
+    std::size_t count() const override
+    {
+        return _entities.size();
+    }
+
+    StorageStats stats() const override
+    {
+        StorageStats stats;
+        stats.typeName = typeid(Component).name();
+        stats.backend = "small-map";
+        stats.count = _values.size();
+        stats.capacity = _values.capacity();
+        accumulateBytes(_values, stats.bytesUsed, stats.bytesReserved);
+        accumulateBytes(_entities, stats.bytesUsed, stats.bytesReserved);
+        return stats;
+    }
+
+    Component *find(EntityId id)
+    {
+        const std::size_t slot = index(id);
+        return slot != _entities.size() ? &_values[slot] : nullptr;
+    }
+
+    const Component *find(EntityId id) const
+    {
+        const std::size_t slot = index(id);
+        return slot != _entities.size() ? &_values[slot] : nullptr;
+    }
+
+    Component &at(std::size_t slot) { return _values[slot]; }
+    const Component &at(std::size_t slot) const { return _values[slot]; }
+
+    /**
+     * @brief Slot of an entity, or count() when absent
+     */
+    std::size_t index(EntityId id) const
+    {
+        return static_cast<std::size_t>(std::find(_entities.begin(), _entities.end(), id) - _entities.begin());
+    }
+
+    void swapSlots(std::size_t a, std::size_t b)
+    {
+        if (a == b)
+            return;
+
+        std::swap(_values[a], _values[b]);
+        std::swap(_entities[a], _entities[b]);
+    }
+
+    const std::pmr::vector<EntityId> &entities() const { return _entities; }
+
+private:
+    std::pmr::vector<Component> _values;
+    std::pmr::vector<EntityId> _entities;
+};
+
+/**
+ * @brief Membership-only storage for empty marker components (TagStorage policy)
+ *
+ * A sparse set of owners with no value array: every owner shares one
+ * instance of the (stateless) component.
+ */
+template <typename Component>
+class ComponentStorage<Component, TagStorage> : public IComponentStorage
+{
+    static_assert(std::is_empty_v<Component>, "TagStorage only fits empty component types");
+
+public:
+    explicit ComponentStorage(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : _entities(resource), _sparse(resource)
+    {
+    }
+
+    Component &emplace(EntityId id, Component &&)
+    {
+        if (hasEntity(id))
+            return _instance;
+
+        const std::uint32_t slot = entityIndex(id);
+        if (slot >= _sparse.size())
+            _sparse.resize(static_cast<std::size_t>(slot) + 1, kInvalidIndex);
+
+        _sparse[slot] = static_cast<std::uint32_t>(_entities.size());
+        _entities.push_back(id);
+        return _instance;
+    }
+
+    void removeEntity(EntityId id) override
+    {
+        if (!hasEntity(id))
+            return;
+
+        const std::uint32_t index = _sparse[entityIndex(id)];
+        const std::uint32_t last = static_cast<std::uint32_t>(_entities.size() - 1);
+
+        if (index != last)
+        {
+            _entities[index] = _entities[last];
+            _sparse[entityIndex(_entities[index])] = index;
+        }
+
+        _entities.pop_back();
+        _sparse[entityIndex(id)] = kInvalidIndex;
+    }
+
+    bool hasEntity(EntityId id) const override
+    {
+        const std::uint32_t slot = entityIndex(id);
+        return slot < _sparse.size() && _sparse[slot] != kInvalidIndex && _entities[_sparse[slot]] == id;
+    }
+
+    std::size_t count() const override
+    {
+        return _entities.size();
+    }
+
+    StorageStats stats() const override
+    {
+        StorageStats stats;
+        stats.typeName = typeid(Component).name();
+        stats.backend = "tag";
+        stats.count = _entities.size();
+        stats.capacity = _entities.capacity();
+        stats.sparseSize = _sparse.size();
+        accumulateBytes(_entities, stats.bytesUsed, stats.bytesReserved);
+        accumulateBytes(_sparse, stats.bytesUsed, stats.bytesReserved);
+        return stats;
+    }
+
+    Component *find(EntityId id)
+    {
+        return hasEntity(id) ? &_instance : nullptr;
+    }
+
+    const Component *find(EntityId id) const
+    {
+        return hasEntity(id) ? &_instance : nullptr;
+    }
+
+    Component &at(std::size_t) { return _instance; }
+    const Component &at(std::size_t) const { return _instance; }
+
+    std::size_t index(EntityId id) const
+    {
+        return _sparse[entityIndex(id)];
+    }
+
+    void swapSlots(std::size_t a, std::size_t b)
+    {
+        if (a == b)
+            return;
+
+        std::swap(_entities[a], _entities[b]);
+        _sparse[entityIndex(_entities[a])] = static_cast<std::uint32_t>(a);
+        _sparse[entityIndex(_entities[b])] = static_cast<std::uint32_t>(b);
+    }
+
+    const std::pmr::vector<EntityId> &entities() const { return _entities; }
+
+private:
+    static constexpr std::uint32_t kInvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    Component _instance{};
+    std::pmr::vector<EntityId> _entities;
+    std::pmr::vector<std::uint32_t> _sparse;
+};
+
+}
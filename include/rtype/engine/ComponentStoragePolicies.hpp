@@ -0,0 +1,30 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** ComponentStoragePolicies - Storage backends picked for the game components
+*/
+
+#pragma once
+
+#include "rtype/common/Components.hpp"
+#include "rtype/engine/StoragePolicy.hpp"
+
+namespace rtype::engine
+{
+
+// At most one per player (4 per room): no sparse index needed
+template <>
+struct StoragePolicy<PlayerPowerUpStatus> { using type = SmallMapStorage; };
+
+template <>
+struct StoragePolicy<PlayerComponent> { using type = SmallMapStorage; };
+
+template <>
+struct StoragePolicy<PlayerInputComponent> { using type = SmallMapStorage; };
+
+// Only the second boss carries it
+template <>
+struct StoragePolicy<Boss2Behavior> { using type = SmallMapStorage; };
+
+}
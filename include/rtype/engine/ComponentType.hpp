@@ -0,0 +1,80 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** ComponentType - Static per-type component indices
+*/
+
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <type_traits>
+
+namespace rtype::engine
+{
+
+/// Dense index identifying a component type, used to address flat storage arrays
+using ComponentTypeId = std::size_t;
+
+/// Upper bound on distinct component types (one bit per type in a signature)
+constexpr std::size_t kMaxComponentTypes = 64;
+
+/// Per-entity signature: bit N is set when the entity owns component type N
+using ComponentMask = std::bitset<kMaxComponentTypes>;
+
+namespace detail
+{
+/**
+ * @brief Hand out the next free component type index
+ *
+ * Defined in Registry.cpp so every translation unit shares one counter.
+ * Throws std::length_error past kMaxComponentTypes.
+ */
+ComponentTypeId nextComponentTypeId();
+
+template <typename Component>
+ComponentTypeId componentTypeIdImpl()
+{
+    static const ComponentTypeId id = nextComponentTypeId();
+    return id;
+}
+}
+
+/**
+ * @brief Get the index of a component type
+ *
+ * Indices are assigned on first use and stay stable for the process lifetime.
+ * cv-qualifiers are ignored so `const Transform` and `Transform` share a slot.
+ */
+template <typename Component>
+ComponentTypeId componentTypeId()
+{
+    return detail::componentTypeIdImpl<std::remove_cv_t<Component>>();
+}
+
+/**
+ * @brief Build the signature matching a set of component types
+ */
+template <typename... Components>
+ComponentMask componentMask()
+{
+    ComponentMask mask;
+    (mask.set(componentTypeId<Components>()), ...);
+    return mask;
+}
+
+/**
+ * @brief Tag listing component types a view must NOT contain
+ *
+ * Usage: registry.view<Transform>(engine::exclude<PlayerComponent>, fn);
+ */
+template <typename... Components>
+struct Exclude
+{
+};
+
+template <typename... Components>
+inline constexpr Exclude<Components...> exclude{};
+
+}
@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** CpuFeatures - Vector instruction sets available on the running CPU
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace rtype::engine
+{
+
+/**
+ * @brief Vector instruction set tiers, ordered: each one implies the previous
+ */
+enum class SimdLevel : std::uint8_t
+{
+    Scalar,  ///< Portable C++ only
+    Sse42,   ///< SSE up to 4.2, 4 float lanes
+    Avx2,    ///< AVX2, 8 float lanes
+    Avx512,  ///< AVX-512 Foundation, 16 float lanes
+};
+
+/**
+ * @brief Best tier the CPU and OS support (queried once, then cached)
+ *
+ * Always Scalar on non-x86 targets. AVX tiers also require the OS to save
+ * the wider registers, which CPUID alone does not guarantee.
+ */
+SimdLevel detectSimdLevel();
+
+/// "scalar", "sse4.2", "avx2" or "avx512"
+const char *simdLevelName(SimdLevel level);
+
+/**
+ * @brief Parse a simdLevelName() string (case-sensitive)
+ * @return nullopt for anything else, including "auto"
+ */
+std::optional<SimdLevel> parseSimdLevel(std::string_view name);
+
+}
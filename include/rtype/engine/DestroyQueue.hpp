@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** DestroyQueue - Entities marked for destruction at the end of a tick
+*/
+
+#pragma once
+
+#include "rtype/common/Types.hpp"
+#include "rtype/engine/Entity.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace rtype::engine
+{
+
+/**
+ * @brief Deduplicated list of entities to destroy once the tick is over
+ *
+ * One bit per entity slot makes mark() and contains() a shift and a mask;
+ * the dense list keeps the marked handles in marking order for whoever
+ * flushes or reports them. clear() only resets the words that were touched,
+ * so once the bitset covers the registry's slots nothing allocates.
+ *
+ * Marks are per slot: a marked entity must stay alive until the queue is
+ * flushed and cleared, which holds as long as the tick destroys entities
+ * through the queue only.
+ */
+class DestroyQueue
+{
+public:
+    explicit DestroyQueue(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : _bits(resource), _entities(resource)
+    {
+    }
+
+    /**
+     * @brief Mark an entity, returning false when it already was (or is null)
+     */
+    bool mark(EntityId id)
+    {
+        if (id == kNullEntity)
+            return false;
+
+        const std::uint32_t slot = entityIndex(id);
+        const std::size_t word = slot / kWordBits;
+        if (word >= _bits.size())
+            _bits.resize(word + 1, 0);
+
+        const std::uint64_t bit = std::uint64_t{1} << (slot % kWordBits);
+        if (_bits[word] & bit)
+            return false;
+
+        _bits[word] |= bit;
+        _entities.push_back(id);
+        return true;
+    }
+
+    bool contains(EntityId id) const
+    {
+        const std::uint32_t slot = entityIndex(id);
+        const std::size_t word = slot / kWordBits;
+        return word < _bits.size() && (_bits[word] >> (slot % kWordBits)) & 1u && id != kNullEntity;
+    }
+
+    /// Marked entities, in marking order
+    const std::pmr::vector<EntityId> &entities() const { return _entities; }
+
+    auto begin() const { return _entities.begin(); }
+    auto end() const { return _entities.end(); }
+
+    std::size_t size() const { return _entities.size(); }
+    bool empty() const { return _entities.empty(); }
+
+    /**
+     * @brief Pre-size the bitset for entity slots below slots
+     */
+    void reserve(std::size_t slots)
+    {
+        const std::size_t words = (slots + kWordBits - 1) / kWordBits;
+        if (words > _bits.size())
+            _bits.resize(words, 0);
+    }
+
+    void clear()
+    {
+        for (EntityId id : _entities)
+            _bits[entityIndex(id) / kWordBits] = 0;
+        _entities.clear();
+    }
+
+private:
+    static constexpr std::size_t kWordBits = 64;
+
+    std::pmr::vector<std::uint64_t> _bits;
+    std::pmr::vector<EntityId> _entities;
+};
+
+}
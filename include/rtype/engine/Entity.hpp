@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** Entity - Generational entity handle layout
+*/
+
+#pragma once
+
+#include "rtype/common/Types.hpp"
+
+#include <cstdint>
+
+namespace rtype::engine
+{
+
+/**
+ * EntityId is a versioned handle: the low bits index the entity slot, the
+ * high bits hold the generation of that slot. Destroying an entity bumps
+ * the generation, so any handle still pointing at the old occupant stops
+ * matching once the slot is reused.
+ *
+ * Slot 0 is never handed out, so EntityId 0 always means "no entity".
+ */
+constexpr std::uint32_t kEntityIndexBits = 20;
+constexpr std::uint32_t kEntityGenerationBits = 32 - kEntityIndexBits;
+constexpr std::uint32_t kEntityIndexMask = (1u << kEntityIndexBits) - 1;
+constexpr std::uint32_t kEntityGenerationMask = (1u << kEntityGenerationBits) - 1;
+
+/// Largest number of simultaneously live entities in one Registry
+constexpr std::uint32_t kMaxEntities = kEntityIndexMask;
+
+constexpr EntityId kNullEntity = 0;
+
+constexpr std::uint32_t entityIndex(EntityId id)
+{
+    return id & kEntityIndexMask;
+}
+
+constexpr std::uint32_t entityGeneration(EntityId id)
+{
+    return id >> kEntityIndexBits;
+}
+
+constexpr EntityId makeEntityId(std::uint32_t index, std::uint32_t generation)
+{
+    return ((generation & kEntityGenerationMask) << kEntityIndexBits) | (index & kEntityIndexMask);
+}
+
+}
@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** FixedTimestep - Accumulator turning frame time into fixed simulation ticks
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rtype::engine
+{
+
+/**
+ * @brief Decouples the simulation rate from the loop's measured frame time
+ *
+ * Frame time is accumulated and spent in whole steps of 1 / tickRate
+ * seconds, so every simulation tick sees the same dt whatever the host
+ * load. When a frame is so late that more than maxSubsteps steps are owed,
+ * the extra steps are dropped (the simulation slows down) instead of being
+ * run, which would make the next frame even later (spiral of death).
+ *
+ * Typical loop:
+ * @code
+ * const std::size_t steps = clock.advance(frameDt);
+ * for (std::size_t i = 0; i < steps; ++i)
+ *     simulate(clock.step());
+ * render(clock.alpha());
+ * @endcode
+ */
+class FixedTimestep
+{
+public:
+    static constexpr float kDefaultTickRate = 60.0f;
+    static constexpr std::size_t kDefaultMaxSubsteps = 5;
+
+    /**
+     * @param tickRate Simulation ticks per second (clamped to at least 1)
+     * @param maxSubsteps Most ticks run for one frame (clamped to at least 1)
+     */
+    explicit FixedTimestep(float tickRate = kDefaultTickRate, std::size_t maxSubsteps = kDefaultMaxSubsteps);
+
+    /**
+     * @brief Add a frame's elapsed time and return how many ticks to run now
+     *
+     * The returned ticks are counted in tick() right away.
+     */
+    std::size_t advance(float frameSeconds);
+
+    /// Seconds simulated by one tick
+    float step() const { return _step; }
+    float tickRate() const { return 1.0f / _step; }
+    std::size_t maxSubsteps() const { return _maxSubsteps; }
+
+    /// Ticks handed out by advance() since construction
+    std::uint64_t tick() const { return _tick; }
+
+    /// Ticks skipped because a frame owed more than maxSubsteps
+    std::uint64_t droppedTicks() const { return _dropped; }
+
+    /**
+     * @brief Progress towards the next tick, in [0, 1)
+     *
+     * Blend factor between the last two simulated states for anything
+     * presented between ticks.
+     */
+    float alpha() const { return _accumulator / _step; }
+
+    /// Seconds of frame time still missing before the next tick is due
+    float timeUntilNextTick() const { return _step - _accumulator; }
+
+private:
+    float _step;
+    std::size_t _maxSubsteps;
+    float _accumulator{0.0f};
+    std::uint64_t _tick{0};
+    std::uint64_t _dropped{0};
+};
+
+}
@@ -0,0 +1,171 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** Group - Persistent multi-component joins kept packed in storage
+*/
+
+#pragma once
+
+#include "rtype/common/Types.hpp"
+#include "rtype/engine/CommandBuffer.hpp"
+#include "rtype/engine/ComponentStorage.hpp"
+#include "rtype/engine/ComponentType.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace rtype::engine
+{
+
+template <typename... Components>
+struct TypeList
+{
+};
+
+/**
+ * @brief Tag listing components a group reads through the sparse index
+ *        instead of owning them
+ *
+ * Usage: registry.group<Hurtbox>(engine::observe<Transform, Collider>);
+ */
+template <typename... Components>
+struct Observe
+{
+};
+
+template <typename... Components>
+inline constexpr Observe<Components...> observe{};
+
+/**
+ * @brief Type-erased group interface so the Registry can notify every group
+ */
+class IGroup
+{
+public:
+    IGroup(ComponentMask owned, ComponentMask required)
+        : _owned(owned), _required(required) {}
+    virtual ~IGroup() = default;
+
+    /**
+     * @brief Called after a component is added: pack the entity if it now matches
+     */
+    virtual void onComponentAdded(EntityId id, const ComponentMask &signature) = 0;
+
+    /**
+     * @brief Called before a component is removed: unpack the entity if it was a member
+     */
+    virtual void onComponentRemoved(EntityId id) = 0;
+
+    /// Components whose storage this group reorders
+    const ComponentMask &owned() const { return _owned; }
+
+    /// Owned plus observed components: the full signature of a member
+    const ComponentMask &required() const { return _required; }
+
+protected:
+    ComponentMask _owned;
+    ComponentMask _required;
+};
+
+template <typename OwnedList, typename ObservedList>
+class Group;
+
+/**
+ * @brief Owning group, in the spirit of EnTT's owning groups
+ *
+ * Every entity owning all of Owned... and Observed... is kept in the first
+ * size() slots of each owned storage, in the same order. Iteration is then a
+ * linear walk over aligned dense arrays; observed components are fetched
+ * through their sparse index. A component type can be owned by one group only.
+ */
+template <typename... Owned, typename... Observed>
+class Group<TypeList<Owned...>, TypeList<Observed...>> : public IGroup
+{
+    static_assert(sizeof...(Owned) > 0, "a group must own at least one component type");
+
+public:
+    Group(CommandBuffer &commands, ComponentStorage<Owned> *...owned, ComponentStorage<Observed> *...observed)
+        : IGroup(componentMask<Owned...>(), componentMask<Owned..., Observed...>())
+        , _commands(commands)
+        , _ownedStorages(owned...)
+        , _observedStorages(observed...)
+    {
+    }
+
+    void onComponentAdded(EntityId id, const ComponentMask &signature) override
+    {
+        if ((signature & _required) != _required || contains(id))
+            return;
+
+        (swapInto<Owned>(id, _size), ...);
+        ++_size;
+    }
+
+    void onComponentRemoved(EntityId id) override
+    {
+        if (!contains(id))
+            return;
+
+        --_size;
+        (swapInto<Owned>(id, _size), ...);
+    }
+
+    bool contains(EntityId id) const
+    {
+        const auto *lead = std::get<0>(_ownedStorages);
+        return lead->hasEntity(id) && lead->index(id) < _size;
+    }
+
+    std::size_t size() const { return _size; }
+
+    /// Member entities, packed: entities()[i] owns the i-th element of raw<T>()
+    const EntityId *entities() const { return std::get<0>(_ownedStorages)->entities().data(); }
+
+    /**
+     * @brief Packed array of an owned component, aligned with entities()
+     */
+    template <typename Component>
+    Component *raw()
+    {
+        static_assert(std::is_same_v<StoragePolicyOf<Component>, DenseStorage>,
+                      "raw() needs a component stored with the DenseStorage policy");
+        return std::get<ComponentStorage<Component> *>(_ownedStorages)->components().data();
+    }
+
+    /**
+     * @brief Visit every member (must accept EntityId, Owned&..., Observed&...)
+     *
+     * Structural changes made by the callback are deferred to the registry
+     * command buffer and applied once the outermost iteration returns.
+     */
+    template <typename Func>
+    void each(Func &&func)
+    {
+        CommandBuffer::Scope scope(_commands);
+
+        for (std::size_t i = _size; i-- > 0;)
+        {
+            const EntityId id = entities()[i];
+            func(id,
+                 std::get<ComponentStorage<Owned> *>(_ownedStorages)->at(i)...,
+                 *std::get<ComponentStorage<Observed> *>(_observedStorages)->find(id)...);
+        }
+    }
+
+private:
+    template <typename Component>
+    void swapInto(EntityId id, std::size_t slot)
+    {
+        auto *storage = std::get<ComponentStorage<Component> *>(_ownedStorages);
+        storage->swapSlots(storage->index(id), slot);
+    }
+
+    CommandBuffer &_commands;
+    std::tuple<ComponentStorage<Owned> *...> _ownedStorages;
+    std::tuple<ComponentStorage<Observed> *...> _observedStorages;
+    std::size_t _size{0};
+};
+
+}
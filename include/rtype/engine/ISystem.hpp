@@ -1,7 +1,9 @@
 #pragma once
 
-#include <unordered_set>
+#include <cstdint>
+#include <limits>
 #include "rtype/engine/Registry.hpp"
+#include "rtype/engine/DestroyQueue.hpp"
 #include "rtype/common/GameConfig.hpp"
 
 
@@ -10,6 +12,103 @@ namespace rtype::engine
 
 // ========== System Abstractions ==========
 
+/**
+ * @brief Components and shared state a system touches during update()
+ *
+ * The pipeline lets two systems run at the same time only when neither
+ * writes a component the other reads or writes, at most one of them uses
+ * the destroy list, and neither reads the registry's SpatialIndex while the
+ * other rebuilds it. Writing includes patch() and markChanged().
+ *
+ * A system that creates or destroys entities, adds or removes components,
+ * creates groups after its first update, or changes the level must stay
+ * exclusive: it then runs alone, in registration order.
+ */
+struct SystemAccess
+{
+    ComponentMask reads;
+    ComponentMask writes;
+    bool destroyList{false};
+    bool spatialIndexRead{false};
+    bool spatialIndexWrite{false};
+    bool exclusive{false};
+
+    template <typename... Components>
+    SystemAccess &read()
+    {
+        reads |= componentMask<Components...>();
+        return *this;
+    }
+
+    template <typename... Components>
+    SystemAccess &write()
+    {
+        writes |= componentMask<Components...>();
+        return *this;
+    }
+
+    /// The system reads or marks entities in the toDestroy queue
+    SystemAccess &usesDestroyList()
+    {
+        destroyList = true;
+        return *this;
+    }
+
+    /// The system queries Registry::spatialIndex()
+    SystemAccess &readsSpatialIndex()
+    {
+        spatialIndexRead = true;
+        return *this;
+    }
+
+    /// The system rebuilds Registry::spatialIndex()
+    SystemAccess &buildsSpatialIndex()
+    {
+        spatialIndexWrite = true;
+        return *this;
+    }
+
+    /// Conservative default: conflicts with every other system
+    static SystemAccess all()
+    {
+        SystemAccess access;
+        access.exclusive = true;
+        return access;
+    }
+
+    bool conflictsWith(const SystemAccess &other) const
+    {
+        if (exclusive || other.exclusive)
+            return true;
+        if (destroyList && other.destroyList)
+            return true;
+        if ((spatialIndexWrite && (other.spatialIndexRead || other.spatialIndexWrite)) || (other.spatialIndexWrite && spatialIndexRead))
+            return true;
+        return (writes & (other.reads | other.writes)).any() || (other.writes & reads).any();
+    }
+};
+
+/**
+ * @brief How often the pipeline runs a system
+ *
+ * The system runs on the ticks where tick % divisor == phase and receives
+ * the dt accumulated since its previous run. With kAutoPhase the pipeline
+ * picks the phase itself so that decimated systems land on different ticks.
+ */
+struct SystemRate
+{
+    static constexpr std::uint32_t kAutoPhase = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t divisor{1};
+    std::uint32_t phase{kAutoPhase};
+
+    /// Run once every divisor ticks
+    static SystemRate every(std::uint32_t divisor, std::uint32_t phase = kAutoPhase)
+    {
+        return SystemRate{divisor, phase};
+    }
+};
+
 /**
  * @brief Base class for all systems in the ECS
  */
@@ -24,9 +123,23 @@ public:
      * @param deltaTime Time elapsed since last update (in seconds)
      * @param currentLevel A reference to the current level of the game.
      * @param registry The ECS registry containing all entities and components
-     * @param toDestroy The list of entities that will be destroyed by the engine
+     * @param toDestroy Entities that will be destroyed once the tick is over
+     */
+    virtual void update(float deltaTime, int &currentLevel, Registry &registry, DestroyQueue &toDestroy) = 0;
+
+    /**
+     * @brief Declare what update() touches (see SystemAccess)
+     *
+     * Systems that don't override this are exclusive.
+     */
+    virtual SystemAccess access() const { return SystemAccess::all(); }
+
+    /**
+     * @brief Declare how often update() needs to run (see SystemRate)
+     *
+     * Defaults to every tick; systems.ini can override it per system.
      */
-    virtual void update(float deltaTime, int &currentLevel, Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) = 0;
+    virtual SystemRate rate() const { return {}; }
 
 protected:
     const config::GameConfig &_config;
@@ -0,0 +1,218 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** JobSystem - Work-stealing thread pool with fork/join helpers
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rtype::engine
+{
+
+class JobSystem;
+
+/**
+ * @brief Fork/join handle: jobs spawned through it are joined by wait()
+ *
+ * wait() is the barrier. The waiting thread runs queued jobs (its own or
+ * stolen ones) instead of sleeping, so groups can be nested freely, e.g. a
+ * system running on a worker may fork its own parallelFor.
+ *
+ * spawn() and wait() must be called from the thread owning the group.
+ */
+class JobGroup
+{
+public:
+    explicit JobGroup(JobSystem &jobs) : _jobs(jobs) {}
+
+    /// Joins outstanding jobs; exceptions are only reported through wait()
+    ~JobGroup();
+
+    JobGroup(const JobGroup &) = delete;
+    JobGroup &operator=(const JobGroup &) = delete;
+
+    /**
+     * @brief Queue a task; the group keeps it alive until it ran
+     */
+    template <typename Func>
+    void spawn(Func &&func);
+
+    /**
+     * @brief Block until every spawned job finished
+     *
+     * Rethrows the first exception thrown by one of them.
+     */
+    void wait();
+
+private:
+    friend class JobSystem;
+
+    void fail(std::exception_ptr error);
+
+    JobSystem &_jobs;
+    std::deque<std::function<void()>> _tasks;
+    std::atomic<std::size_t> _pending{0};
+    std::exception_ptr _error;
+    std::mutex _errorMutex;
+};
+
+/**
+ * @brief Pool of worker threads with one job deque each
+ *
+ * A worker pushes and pops jobs at the back of its own deque (LIFO, cache
+ * friendly for nested forks) and steals from the front of the others when it
+ * runs dry. Threads outside the pool spread their jobs over the deques.
+ * Jobs are plain function pointer + context records, so parallelFor does
+ * not allocate.
+ *
+ * One instance is meant to be shared by the whole server: the pipelines of
+ * every room and any system or loop that wants to fork.
+ */
+class JobSystem
+{
+public:
+    /// Target number of chunks per thread in parallelFor, for load balancing
+    static constexpr std::size_t kChunksPerThread = 4;
+
+    explicit JobSystem(std::size_t workers);
+    ~JobSystem();
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    std::size_t workerCount() const { return _threads.size(); }
+
+    /// Threads that can run jobs at once: the workers plus the waiting caller
+    std::size_t concurrency() const { return _threads.size() + 1; }
+
+    /// Upper bound on the chunks parallelFor splits a range into
+    std::size_t maxChunks() const { return concurrency() * kChunksPerThread; }
+
+    /**
+     * @brief Split [begin, end) into chunks of at least grain items and run them concurrently
+     * @param func Called as func(chunkBegin, chunkEnd, chunkIndex); chunk indices are
+     *        dense, ordered like the ranges, and below maxChunks()
+     *
+     * Returns once every chunk ran (the caller runs the first one itself).
+     * Rethrows the first exception thrown by a chunk.
+     */
+    template <typename Func>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Func &&func);
+
+private:
+    friend class JobGroup;
+
+    struct Job
+    {
+        void (*invoke)(const void *context, std::size_t index);
+        const void *context;
+        std::size_t index;
+        JobGroup *group;
+    };
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    template <typename Func>
+    struct Chunks
+    {
+        const Func *func;
+        std::size_t begin;
+        std::size_t end;
+        std::size_t size;
+
+        static void invoke(const void *context, std::size_t chunk)
+        {
+            const auto &self = *static_cast<const Chunks *>(context);
+            const std::size_t first = self.begin + chunk * self.size;
+            (*self.func)(first, std::min(first + self.size, self.end), chunk);
+        }
+    };
+
+    static void invokeTask(const void *context, std::size_t);
+
+    void submit(const Job &job);
+    bool tryRunOne();
+    void execute(const Job &job);
+    void waitFor(JobGroup &group);
+    void workerLoop(std::size_t index);
+
+    /// Queue of the calling thread if it is one of our workers, else queues size
+    std::size_t localQueue() const;
+
+    std::vector<std::unique_ptr<Queue>> _queues;
+    std::vector<std::thread> _threads;
+    std::atomic<std::size_t> _queued{0};
+    std::atomic<std::size_t> _nextQueue{0};
+
+    std::mutex _sleepMutex;
+    std::condition_variable _wake;
+    std::condition_variable _done;
+    bool _stopping{false};
+};
+
+// ========== Template Implementations ==========
+
+template <typename Func>
+void JobGroup::spawn(Func &&func)
+{
+    _tasks.emplace_back(std::forward<Func>(func));
+    _pending.fetch_add(1, std::memory_order_relaxed);
+    _jobs.submit(JobSystem::Job{&JobSystem::invokeTask, &_tasks.back(), 0, this});
+}
+
+template <typename Func>
+void JobSystem::parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Func &&func)
+{
+    if (begin >= end)
+        return;
+
+    const std::size_t count = end - begin;
+    const std::size_t byGrain = (count + std::max<std::size_t>(grain, 1) - 1) / std::max<std::size_t>(grain, 1);
+    const std::size_t chunks = std::min(byGrain, _threads.empty() ? std::size_t{1} : maxChunks());
+
+    if (chunks <= 1)
+    {
+        func(begin, end, std::size_t{0});
+        return;
+    }
+
+    using Body = std::remove_reference_t<Func>;
+    const Chunks<Body> split{&func, begin, end, (count + chunks - 1) / chunks};
+    const std::size_t used = (count + split.size - 1) / split.size;
+
+    JobGroup group(*this);
+    group._pending.store(used - 1, std::memory_order_relaxed);
+    for (std::size_t chunk = 1; chunk < used; ++chunk)
+        submit(Job{&Chunks<Body>::invoke, &split, chunk, &group});
+
+    try
+    {
+        Chunks<Body>::invoke(&split, 0);
+    }
+    catch (...)
+    {
+        group.fail(std::current_exception());
+    }
+    group.wait();
+}
+
+}
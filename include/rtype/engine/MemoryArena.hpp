@@ -0,0 +1,117 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** MemoryArena - Memory resources backing a Registry
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rtype::engine
+{
+
+/**
+ * @brief Pooled arena a Registry can be built on
+ *
+ * A monotonic buffer grabs large chunks from the heap and never gives them
+ * back until the arena dies; a pool on top of it recycles freed blocks, so a
+ * steady game loop reuses its own memory instead of going back to malloc.
+ * Destroying the arena releases every chunk at once.
+ *
+ * The pool is synchronized: systems the SystemPipeline runs in parallel may
+ * grow their change lists at the same time. Refills from the monotonic
+ * buffer happen under the pool's exclusive lock.
+ */
+class MemoryArena
+{
+public:
+    static constexpr std::size_t kDefaultInitialSize = 1 << 20;
+
+    explicit MemoryArena(std::size_t initialSize = kDefaultInitialSize)
+        : _buffer(initialSize)
+        , _pool(&_buffer)
+    {
+    }
+
+    MemoryArena(const MemoryArena &) = delete;
+    MemoryArena &operator=(const MemoryArena &) = delete;
+
+    std::pmr::memory_resource *resource() { return &_pool; }
+
+private:
+    std::pmr::monotonic_buffer_resource _buffer;
+    std::pmr::synchronized_pool_resource _pool;
+};
+
+/**
+ * @brief unique_ptr deleter returning the object to the resource it came from
+ *
+ * Remembers the concrete size/alignment, so it works through a base pointer.
+ */
+template <typename Base>
+struct ResourceDeleter
+{
+    ResourceDeleter() = default;
+    ResourceDeleter(std::pmr::memory_resource *res, std::size_t bytes, std::size_t align)
+        : resource(res), size(bytes), alignment(align)
+    {
+    }
+
+    /// Lets ResourcePtr<Derived> convert to ResourcePtr<Base>
+    template <typename Derived>
+        requires std::is_convertible_v<Derived *, Base *>
+    ResourceDeleter(const ResourceDeleter<Derived> &other)
+        : resource(other.resource), size(other.size), alignment(other.alignment)
+    {
+    }
+
+    std::pmr::memory_resource *resource{nullptr};
+    std::size_t size{0};
+    std::size_t alignment{alignof(std::max_align_t)};
+
+    void operator()(Base *object) const
+    {
+        if (!object)
+            return;
+
+        // The allocation starts at the most-derived object, not at Base
+        void *memory = object;
+        if constexpr (std::is_polymorphic_v<Base>)
+            memory = dynamic_cast<void *>(object);
+
+        std::destroy_at(object);
+        resource->deallocate(memory, size, alignment);
+    }
+};
+
+template <typename Base>
+using ResourcePtr = std::unique_ptr<Base, ResourceDeleter<Base>>;
+
+/**
+ * @brief Construct a T inside a memory resource, owned through a Base pointer
+ */
+template <typename T, typename Base = T, typename... Args>
+ResourcePtr<Base> makeResourcePtr(std::pmr::memory_resource *resource, Args &&...args)
+{
+    void *memory = resource->allocate(sizeof(T), alignof(T));
+    T *object;
+    try
+    {
+        object = ::new (memory) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        resource->deallocate(memory, sizeof(T), alignof(T));
+        throw;
+    }
+    return ResourcePtr<Base>(object, ResourceDeleter<Base>{resource, sizeof(T), alignof(T)});
+}
+
+}
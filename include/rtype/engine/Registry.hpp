@@ -1,15 +1,27 @@
 #pragma once
 
 #include "rtype/common/Types.hpp"
+#include "rtype/engine/ChangeSet.hpp"
+#include "rtype/engine/CommandBuffer.hpp"
+#include "rtype/engine/ComponentStorage.hpp"
+#include "rtype/engine/ComponentStoragePolicies.hpp"
+#include "rtype/engine/ComponentType.hpp"
+#include "rtype/engine/Entity.hpp"
+#include "rtype/engine/Group.hpp"
+#include "rtype/engine/JobSystem.hpp"
+#include "rtype/engine/MemoryArena.hpp"
+#include "rtype/engine/RegistryStats.hpp"
+#include "rtype/engine/SpatialIndex.hpp"
 
 #include <functional>
-#include <typeinfo>
-#include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 #include <optional>
 #include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <tuple>
 
 namespace rtype::engine
 {
@@ -17,16 +29,45 @@ namespace rtype::engine
 class Registry
 {
 public:
+    /**
+     * @brief Build a registry whose storages allocate from a memory resource
+     * @param resource Must outlive the registry (e.g. a MemoryArena owned
+     *        alongside it); defaults to the global heap
+     */
+    explicit Registry(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
     // ========== Entity Management ==========
 
+    /**
+     * @brief Create an entity
+     * @return Versioned handle (slot index + generation, see Entity.hpp)
+     *
+     * Throws std::length_error once kMaxEntities entities are alive.
+     */
     EntityId createEntity();
     
+    /**
+     * @brief Destroy an entity and all its components
+     *
+     * Stale or unknown handles are ignored, so destroying twice is harmless.
+     */
     void destroyEntity(EntityId id);
 
+    /**
+     * @brief Check that a handle still refers to a live entity (one array compare)
+     */
     bool entityExists(EntityId id) const;
 
     // ========== Component Management ==========
     
+    /**
+     * @brief Add (or overwrite) a component
+     *
+     * While an iteration is running the insertion is deferred (see
+     * CommandBuffer) and the returned reference points at the buffered value:
+     * it can be filled in, but getComponent() won't see it before the sync point.
+     * Throws std::out_of_range if the entity does not exist.
+     */
     template <typename Component, typename... Args>
     Component &addComponent(EntityId id, Args &&...args);
 
@@ -88,6 +129,9 @@ public:
      * @tparam Component Type of component to iterate
      * @tparam Func Function type (must accept EntityId and Component&)
      * @param func Callback function called for each entity
+     *
+     * Walks the storage in place; structural changes made by the callback
+     * are deferred until the outermost iteration returns.
      */
     template <typename Component, typename Func>
     void forEach(Func &&func);
@@ -111,67 +155,197 @@ public:
     void each(Func &&func) const;
     
     /**
-     * @brief Iterate over entities with MULTIPLE components (2 components)
-     * @tparam C1 First component type
-     * @tparam C2 Second component type
-     * @tparam Func Function type (must accept EntityId, C1&, C2&)
+     * @brief Iterate over entities owning ALL of the listed components
+     * @tparam Components Component types to join (at least one)
+     * @tparam Func Function type (must accept EntityId, Components&...)
      * @param func Callback function
+     *
+     * The smallest storage drives the join; every candidate is filtered on
+     * its signature before any component data is touched.
      */
-    template <typename C1, typename C2, typename Func>
+    template <typename... Components, typename Func>
     void view(Func &&func);
     
     /**
-     * @brief Iterate over entities with MULTIPLE components (3 components)
+     * @brief Same as view(func), skipping entities owning any excluded component
+     *
+     * Usage: registry.view<Transform>(engine::exclude<PlayerComponent>, fn);
      */
-    template <typename C1, typename C2, typename C3, typename Func>
-    void view(Func &&func);
+    template <typename... Components, typename... Excluded, typename Func>
+    void view(Exclude<Excluded...>, Func &&func);
 
-    template <typename C1, typename C2, typename Func>
+    template <typename... Components, typename Func>
     void view(Func &&func) const;
 
+    template <typename... Components, typename... Excluded, typename Func>
+    void view(Exclude<Excluded...>, Func &&func) const;
+
+    // ========== Parallel Iteration ==========
+    
+    /// Smallest number of entities worth handing to another thread
+    static constexpr std::size_t kParallelGrain = 256;
+    
+    /**
+     * @brief Job system used by parallelForEach/parallelPatch (null = run sequentially)
+     */
+    void setJobSystem(JobSystem *jobs);
+    JobSystem *jobSystem() const;
+
+    // ========== Spatial Queries ==========
+
+    /**
+     * @brief Index of entity positions rebuilt once per tick, shared by every system
+     *
+     * Not owned; null until the owner installs one. Whoever fills it (on the
+     * server, SpatialIndexSystem) decides which entities it holds.
+     */
+    void setSpatialIndex(SpatialIndex *index);
+    SpatialIndex *spatialIndex() const;
+    
+    /**
+     * @brief view<Components...>([exclude<...>,] func) split into chunks run concurrently
+     * @tparam Func Function type (must accept EntityId, Components&...)
+     *
+     * The callback runs on several threads at once: it may write the
+     * components it is handed, but must not add/remove components, create
+     * or destroy entities, call patch()/markChanged(), or touch other shared
+     * state without its own synchronization.
+     */
+    template <typename... Components, typename Func>
+    void parallelForEach(Func &&func, std::size_t grain = kParallelGrain);
+
+    template <typename... Components, typename... Excluded, typename Func>
+    void parallelForEach(Exclude<Excluded...>, Func &&func, std::size_t grain = kParallelGrain);
+    
+    /**
+     * @brief parallelForEach whose callback returns true when it modified Component
+     *
+     * Those entities are marked changed after the join, in iteration order,
+     * so tracked components can be written in parallel.
+     */
+    template <typename Component, typename... Others, typename Func>
+    void parallelPatch(Func &&func, std::size_t grain = kParallelGrain);
+
+    template <typename Component, typename... Others, typename... Excluded, typename Func>
+    void parallelPatch(Exclude<Excluded...>, Func &&func, std::size_t grain = kParallelGrain);
+
+    // ========== Groups ==========
+    
+    /**
+     * @brief Get (or create on first call) a persistent group
+     * @tparam Owned Components whose storages the group keeps packed
+     * @tparam Observed Extra required components, read through the sparse index
+     * @return The group, valid for the registry lifetime
+     *
+     * Members are tracked on every add/remove, so iterating a group never
+     * rebuilds the join. Throws std::logic_error if one of Owned is already
+     * owned by a different group.
+     *
+     * Usage: registry.group<Transform, Velocity>().each(fn);
+     *        registry.group<Hurtbox>(engine::observe<Transform, Collider>).each(fn);
+     */
+    template <typename... Owned, typename... Observed>
+    Group<TypeList<Owned...>, TypeList<Observed...>> &group(Observe<Observed...> = {});
+
+    // ========== Change Tracking ==========
+    
+    /**
+     * @brief Opt a component type into change tracking
+     *
+     * Tracked components are marked changed when added, and when written
+     * through patch() or markChanged(). Plain getComponent()/forEach() access
+     * is not tracked: writers of a tracked type must go through those two.
+     */
+    template <typename Component>
+    void trackChanges();
+    
+    template <typename Component>
+    bool isTracked() const;
+    
+    /**
+     * @brief Mutable access that marks the component changed
+     * @return Pointer to component, or nullptr if entity doesn't have it
+     */
+    template <typename Component>
+    Component *patch(EntityId id);
+    
+    /**
+     * @brief Mark a component changed after writing it through another accessor
+     */
+    template <typename Component>
+    void markChanged(EntityId id);
+
+    /**
+     * @brief markChanged() for a batch of entities, in order
+     */
+    template <typename Component>
+    void markChanged(std::span<const EntityId> ids);
+    
+    /**
+     * @brief Visit entities whose Component changed since the last clear
+     * @tparam Func Function type (must accept EntityId, Component&)
+     *
+     * Entities destroyed or stripped of Component since are skipped.
+     */
+    template <typename Component, typename Func>
+    void changed(Func &&func);
+    
+    template <typename Component, typename Func>
+    void changed(Func &&func) const;
+    
+    /**
+     * @brief Whether a tracked component of an entity changed since the last clear
+     */
+    template <typename Component>
+    bool wasChanged(EntityId id) const;
+    
+    /**
+     * @brief Forget the changes of one tracked type
+     */
+    template <typename Component>
+    void clearChanged();
+    
+    /**
+     * @brief Forget the changes of every tracked type (end of a replication tick)
+     */
+    void clearChanged();
+
     std::size_t entityCount() const;
 
+    /**
+     * @brief Simulation ticks completed on this registry
+     *
+     * SystemPipeline::update() advances it once its systems ran, so during an
+     * update it is the index of the tick being simulated (0 for the first).
+     */
+    std::uint64_t tick() const;
+    void advanceTick();
+
+    /**
+     * @brief Number of structural changes waiting for the next sync point
+     */
+    std::size_t pendingCommands() const;
+
     template <typename Component>
     std::size_t componentCount() const;
 
+    /**
+     * @brief Snapshot of entity occupancy and per-storage memory
+     *
+     * Walks every storage once; meant for periodic diagnostics, not per tick.
+     */
+    RegistryStats stats() const;
+
 private:
-    // ========== Internal Storage Structures ==========
-    
-    struct IComponentStorage
-    {
-        virtual ~IComponentStorage() = default;
-        virtual void removeEntity(EntityId id) = 0;
-        virtual bool hasEntity(EntityId id) const = 0;
-        virtual std::size_t count() const = 0;
-    };
+    /**
+     * @brief Let groups pack an entity after one of its components was added
+     */
+    void notifyComponentAdded(EntityId id, ComponentTypeId typeId);
     
     /**
-     * @brief Typed storage for a specific component type
-     * 
-     * This is the INNER MAP : EntityId -> Component instance
-     * All components of type T are stored together for cache efficiency.
+     * @brief Let groups unpack an entity before one of its components is removed
      */
-    template <typename Component>
-    struct ComponentStorage : IComponentStorage
-    {
-        /// Map: Entity ID -> Component data
-        std::unordered_map<EntityId, Component> components;
-        
-        void removeEntity(EntityId id) override 
-        { 
-            components.erase(id); 
-        }
-        
-        bool hasEntity(EntityId id) const override
-        {
-            return components.find(id) != components.end();
-        }
-        
-        std::size_t count() const override
-        {
-            return components.size();
-        }
-    };
+    void notifyComponentRemoved(EntityId id, const ComponentMask &removed);
     
     /**
      * @brief Get or create storage for a component type
@@ -182,33 +356,84 @@ private:
     ComponentStorage<Component> *getOrCreateStorage();
     
     /**
-     * @brief Get storage for a component type (const, doesn't create)
+     * @brief Get storage for a component type (doesn't create)
      * @tparam Component Type of component
      * @return Pointer to storage, or nullptr if it doesn't exist
      */
     template <typename Component>
-    const ComponentStorage<Component> *getStorage() const;
+    ComponentStorage<Component> *getStorage();
     
     /**
-     * @brief Get the type hash for a component type
-     * Used as the key in the outer map to identify component types
+     * @brief Get storage for a component type (const, doesn't create)
      */
     template <typename Component>
-    std::size_t getComponentTypeHash() const;
+    const ComponentStorage<Component> *getStorage() const;
     
     // ========== Member Variables ==========
     
-    /// OUTER MAP : Component type hash -> Storage for that type
-    /// This allows us to store different component types dynamically
-    std::unordered_map<std::size_t, std::unique_ptr<IComponentStorage>> _componentStorages;
+    /**
+     * @brief Check an entity signature against include/exclude masks
+     */
+    bool matches(EntityId id, const ComponentMask &include, const ComponentMask &excluded) const;
+    
+    /**
+     * @brief Pick the entity list of the smallest storage among Components
+     */
+    template <typename... Components>
+    const std::pmr::vector<EntityId> *smallestEntityList() const;
+    
+    /**
+     * @brief Shared walk behind parallelForEach/parallelPatch
+     * @param func Called as func(chunkIndex, EntityId, Components&...)
+     */
+    template <typename... Components, typename Func>
+    void parallelChunks(std::size_t grain, const ComponentMask &excluded, Func &&func);
+    
+    /// Where every storage, group and deferred command is allocated
+    std::pmr::memory_resource *_resource;
+    
+    /// Flat storage table indexed by componentTypeId<Component>()
+    /// Slots stay null until the first component of that type is added
+    std::pmr::vector<ResourcePtr<IComponentStorage>> _componentStorages;
+    
+    /// Per-entity component signature, indexed by entityIndex(id)
+    std::pmr::vector<ComponentMask> _signatures;
     
-    /// Pool of recycled entity IDs
-    std::vector<EntityId> _freeEntityIds;
+    /// Structural changes recorded while an iteration is running
+    CommandBuffer _commands;
     
-    EntityId _nextEntityId{1};
+    /// Persistent groups, notified on every structural change
+    std::pmr::vector<ResourcePtr<IGroup>> _groups;
     
-    /// Set of all active entity IDs (for existence checks)
-    std::unordered_set<EntityId> _activeEntities;
+    /// Per-type change lists, indexed by componentTypeId (null when untracked)
+    std::pmr::vector<ResourcePtr<ChangeSet>> _changeSets;
+    
+    /// Component types opted into change tracking
+    ComponentMask _trackedComponents;
+    
+    /// Components already owned by a group
+    ComponentMask _ownedComponents;
+    
+    /// Handle currently living in each slot, kNullEntity when the slot is free.
+    /// Slot 0 is reserved so kNullEntity never matches a live entity.
+    std::pmr::vector<EntityId> _slots;
+    
+    /// Generation the next occupant of each slot will carry
+    std::pmr::vector<std::uint32_t> _generations;
+    
+    /// Free slot indices, reused oldest first so generations wrap slowly
+    std::pmr::vector<std::uint32_t> _freeSlots;
+    std::size_t _freeSlotsHead{0};
+    
+    std::size_t _aliveCount{0};
+    
+    /// Threads parallelForEach forks onto, not owned
+    JobSystem *_jobs{nullptr};
+
+    /// Shared per-tick spatial index, not owned
+    SpatialIndex *_spatialIndex{nullptr};
+
+    std::uint64_t _tick{0};
 };
 
 
@@ -216,18 +441,75 @@ private:
 
 inline bool Registry::entityExists(EntityId id) const
 {
-    return _activeEntities.find(id) != _activeEntities.end();
+    const std::uint32_t index = entityIndex(id);
+    return index < _slots.size() && _slots[index] == id && id != kNullEntity;
 }
 
 inline std::size_t Registry::entityCount() const
 {
-    return _activeEntities.size();
+    return _aliveCount;
 }
 
-template <typename Component>
-std::size_t Registry::getComponentTypeHash() const
+inline std::uint64_t Registry::tick() const
+{
+    return _tick;
+}
+
+inline void Registry::advanceTick()
+{
+    ++_tick;
+}
+
+inline std::size_t Registry::pendingCommands() const
+{
+    return _commands.size();
+}
+
+inline void Registry::setJobSystem(JobSystem *jobs)
+{
+    _jobs = jobs;
+}
+
+inline JobSystem *Registry::jobSystem() const
+{
+    return _jobs;
+}
+
+inline void Registry::setSpatialIndex(SpatialIndex *index)
+{
+    _spatialIndex = index;
+}
+
+inline SpatialIndex *Registry::spatialIndex() const
 {
-    return typeid(Component).hash_code();
+    return _spatialIndex;
+}
+
+inline bool Registry::matches(EntityId id, const ComponentMask &include, const ComponentMask &excluded) const
+{
+    if (!entityExists(id))
+        return false;
+    
+    const ComponentMask &signature = _signatures[entityIndex(id)];
+    return (signature & include) == include && (signature & excluded).none();
+}
+
+template <typename... Components>
+const std::pmr::vector<EntityId> *Registry::smallestEntityList() const
+{
+    const std::pmr::vector<EntityId> *smallest = nullptr;
+    const auto consider = [&smallest](const auto *storage) {
+        if (!storage)
+            return false;
+        if (!smallest || storage->count() < smallest->size())
+            smallest = &storage->entities();
+        return true;
+    };
+    
+    if (!(consider(getStorage<Components>()) && ...))
+        return nullptr;
+    
+    return smallest;
 }
 
 template <typename Component>
@@ -238,41 +520,67 @@ std::size_t Registry::componentCount() const
 }
 
 template <typename Component>
-Registry::ComponentStorage<Component> *Registry::getOrCreateStorage()
+ComponentStorage<Component> *Registry::getOrCreateStorage()
 {
-    const auto typeHash = getComponentTypeHash<Component>();
-    auto it = _componentStorages.find(typeHash);
+    const ComponentTypeId typeId = componentTypeId<Component>();
     
-    if (it == _componentStorages.end())
-    {
-        auto storage = std::make_unique<ComponentStorage<Component>>();
-        auto *rawPtr = storage.get();
-        _componentStorages.emplace(typeHash, std::move(storage));
-        return rawPtr;
-    }
+    if (typeId >= _componentStorages.size())
+        _componentStorages.resize(typeId + 1);
+    
+    auto &slot = _componentStorages[typeId];
+    if (!slot)
+        slot = makeResourcePtr<ComponentStorage<Component>>(_resource, _resource);
     
-    return static_cast<ComponentStorage<Component> *>(it->second.get());
+    return static_cast<ComponentStorage<Component> *>(slot.get());
 }
 
 template <typename Component>
-const Registry::ComponentStorage<Component> *Registry::getStorage() const
+ComponentStorage<Component> *Registry::getStorage()
 {
-    const auto typeHash = getComponentTypeHash<Component>();
-    auto it = _componentStorages.find(typeHash);
+    const ComponentTypeId typeId = componentTypeId<Component>();
     
-    if (it == _componentStorages.end())
+    if (typeId >= _componentStorages.size())
         return nullptr;
     
-    return static_cast<const ComponentStorage<Component> *>(it->second.get());
+    return static_cast<ComponentStorage<Component> *>(_componentStorages[typeId].get());
+}
+
+template <typename Component>
+const ComponentStorage<Component> *Registry::getStorage() const
+{
+    const ComponentTypeId typeId = componentTypeId<Component>();
+    
+    if (typeId >= _componentStorages.size())
+        return nullptr;
+    
+    return static_cast<const ComponentStorage<Component> *>(_componentStorages[typeId].get());
 }
 
 template <typename Component, typename... Args>
 Component &Registry::addComponent(EntityId id, Args &&...args)
 {
+    // Build the component before touching the storage: the arguments may
+    // reference a component of the same type that an insert would move.
+    Component component{std::forward<Args>(args)...};
+    
+    if (!entityExists(id))
+        throw std::out_of_range("Registry::addComponent: entity does not exist");
+    
+    if (_commands.deferring())
+        return _commands.add<Component>(id, std::move(component));
+    
+    const ComponentTypeId typeId = componentTypeId<Component>();
+    _signatures[entityIndex(id)].set(typeId);
+    
     auto *storage = getOrCreateStorage<Component>();
-    auto &component = storage->components[id];
-    component = Component{std::forward<Args>(args)...};
-    return component;
+    storage->emplace(id, std::move(component));
+    notifyComponentAdded(id, typeId);
+    
+    if (_trackedComponents.test(typeId))
+        _changeSets[typeId]->mark(id);
+    
+    // Look up again: a group may have moved the component to another slot
+    return *storage->find(id);
 }
 
 template <typename Component, typename... Args>
@@ -284,8 +592,24 @@ Component &Registry::emplace(EntityId id, Args &&...args)
 template <typename Component>
 void Registry::removeComponent(EntityId id)
 {
-    auto *storage = getOrCreateStorage<Component>();
-    storage->removeEntity(id);
+    if (_commands.deferring())
+    {
+        // Recorded even if absent now: an add may be pending for this entity
+        if (entityExists(id))
+            _commands.remove<Component>(id);
+        return;
+    }
+    
+    const ComponentTypeId typeId = componentTypeId<Component>();
+    if (!hasComponent<Component>(id))
+        return;
+    
+    ComponentMask removed;
+    removed.set(typeId);
+    notifyComponentRemoved(id, removed);
+    
+    getStorage<Component>()->removeEntity(id);
+    _signatures[entityIndex(id)].reset(typeId);
 }
 
 template <typename Component>
@@ -295,23 +619,17 @@ const Component *Registry::getComponent(EntityId id) const
     if (!storage)
         return nullptr;
     
-    auto it = storage->components.find(id);
-    if (it == storage->components.end())
-        return nullptr;
-    
-    return &it->second;
+    return storage->find(id);
 }
 
 template <typename Component>
 Component *Registry::getComponent(EntityId id)
 {
-    auto *storage = getOrCreateStorage<Component>();
-    auto it = storage->components.find(id);
-    
-    if (it == storage->components.end())
+    auto *storage = getStorage<Component>();
+    if (!storage)
         return nullptr;
     
-    return &it->second;
+    return storage->find(id);
 }
 
 template <typename Component>
@@ -329,11 +647,7 @@ Component *Registry::get(EntityId id)
 template <typename Component>
 bool Registry::hasComponent(EntityId id) const
 {
-    const auto *storage = getStorage<Component>();
-    if (!storage)
-        return false;
-    
-    return storage->hasEntity(id);
+    return entityExists(id) && _signatures[entityIndex(id)].test(componentTypeId<Component>());
 }
 
 template <typename Component>
@@ -342,25 +656,148 @@ bool Registry::has(EntityId id) const
     return hasComponent<Component>(id);
 }
 
-template <typename Component, typename Func>
-void Registry::forEach(Func &&func)
+template <typename... Owned, typename... Observed>
+Group<TypeList<Owned...>, TypeList<Observed...>> &Registry::group(Observe<Observed...>)
 {
-    auto *storage = getOrCreateStorage<Component>();
+    using GroupType = Group<TypeList<Owned...>, TypeList<Observed...>>;
+    
+    const ComponentMask owned = componentMask<Owned...>();
+    const ComponentMask required = componentMask<Owned..., Observed...>();
+    
+    for (auto &existing : _groups)
+    {
+        if (existing->owned() == owned && existing->required() == required)
+            return static_cast<GroupType &>(*existing);
+    }
+    
+    if ((owned & _ownedComponents).any())
+        throw std::logic_error("Registry::group: a component type is already owned by another group");
+    
+    auto created = makeResourcePtr<GroupType>(_resource, _commands, getOrCreateStorage<Owned>()..., getOrCreateStorage<Observed>()...);
+    auto &group = *created;
+    _groups.push_back(std::move(created));
+    _ownedComponents |= owned;
+    
+    // Pack the entities that already match
+    const std::pmr::vector<EntityId> candidates(*smallestEntityList<Owned..., Observed...>(), _resource);
+    for (EntityId id : candidates)
+        group.onComponentAdded(id, _signatures[entityIndex(id)]);
+    
+    return group;
+}
 
-    std::vector<EntityId> entityIds;
-    entityIds.reserve(storage->components.size());
+template <typename Component>
+void Registry::trackChanges()
+{
+    const ComponentTypeId typeId = componentTypeId<Component>();
+    if (_trackedComponents.test(typeId))
+        return;
+    
+    if (typeId >= _changeSets.size())
+        _changeSets.resize(typeId + 1);
+    _changeSets[typeId] = makeResourcePtr<ChangeSet>(_resource, _resource);
+    _trackedComponents.set(typeId);
+}
+
+template <typename Component>
+bool Registry::isTracked() const
+{
+    return _trackedComponents.test(componentTypeId<Component>());
+}
+
+template <typename Component>
+Component *Registry::patch(EntityId id)
+{
+    Component *component = getComponent<Component>(id);
+    if (component)
+        markChanged<Component>(id);
+    return component;
+}
+
+template <typename Component>
+void Registry::markChanged(EntityId id)
+{
+    const ComponentTypeId typeId = componentTypeId<Component>();
+    if (_trackedComponents.test(typeId))
+        _changeSets[typeId]->mark(id);
+}
+
+template <typename Component>
+void Registry::markChanged(std::span<const EntityId> ids)
+{
+    const ComponentTypeId typeId = componentTypeId<Component>();
+    if (!_trackedComponents.test(typeId))
+        return;
+
+    ChangeSet &changes = *_changeSets[typeId];
+    for (EntityId id : ids)
+        changes.mark(id);
+}
+
+template <typename Component, typename Func>
+void Registry::changed(Func &&func)
+{
+    const ComponentTypeId typeId = componentTypeId<Component>();
+    auto *storage = getStorage<Component>();
+    if (!storage || !_trackedComponents.test(typeId))
+        return;
+    
+    CommandBuffer::Scope scope(_commands);
     
-    for (const auto &[id, _] : storage->components)
-        entityIds.push_back(id);
+    // Index loop: the callback may mark more entities of this type
+    const auto &entities = _changeSets[typeId]->entities();
+    for (std::size_t i = 0; i < entities.size(); ++i)
+    {
+        const EntityId id = entities[i];
+        if (auto *component = storage->find(id))
+            func(id, *component);
+    }
+}
 
-    for (EntityId id : entityIds)
+template <typename Component, typename Func>
+void Registry::changed(Func &&func) const
+{
+    const ComponentTypeId typeId = componentTypeId<Component>();
+    const auto *storage = getStorage<Component>();
+    if (!storage || !_trackedComponents.test(typeId))
+        return;
+    
+    for (EntityId id : _changeSets[typeId]->entities())
     {
-        auto it = storage->components.find(id);
-        if (it != storage->components.end())
-            func(id, it->second);
+        if (const auto *component = storage->find(id))
+            func(id, *component);
     }
 }
 
+template <typename Component>
+bool Registry::wasChanged(EntityId id) const
+{
+    const ComponentTypeId typeId = componentTypeId<Component>();
+    return _trackedComponents.test(typeId) && _changeSets[typeId]->contains(id);
+}
+
+template <typename Component>
+void Registry::clearChanged()
+{
+    const ComponentTypeId typeId = componentTypeId<Component>();
+    if (_trackedComponents.test(typeId))
+        _changeSets[typeId]->clear();
+}
+
+template <typename Component, typename Func>
+void Registry::forEach(Func &&func)
+{
+    auto *storage = getStorage<Component>();
+    if (!storage)
+        return;
+
+    CommandBuffer::Scope scope(_commands);
+    
+    const auto &entities = storage->entities();
+    for (std::size_t i = 0; i < entities.size(); ++i)
+        func(entities[i], storage->at(i));
+}
+
 template <typename Component, typename Func>
 void Registry::forEach(Func &&func) const
 {
@@ -368,8 +805,9 @@ void Registry::forEach(Func &&func) const
     if (!storage)
         return;
     
-    for (const auto &[id, component] : storage->components)
-        func(id, component);
+    const auto &entities = storage->entities();
+    for (std::size_t i = 0; i < entities.size(); ++i)
+        func(entities[i], storage->at(i));
 }
 
 template <typename Component, typename Func>
@@ -384,52 +822,163 @@ void Registry::each(Func &&func) const
     forEach<Component>(std::forward<Func>(func));
 }
 
-template <typename C1, typename C2, typename Func>
+template <typename... Components, typename Func>
 void Registry::view(Func &&func)
 {
-    auto *storage1 = getOrCreateStorage<C1>();
-    auto *storage2 = getOrCreateStorage<C2>();
+    view<Components...>(exclude<>, std::forward<Func>(func));
+}
 
-    if (storage1->components.size() <= storage2->components.size()) {
-        for (auto &[id, comp1] : storage1->components) {
-            auto *comp2 = getComponent<C2>(id);
-            if (comp2) {
-                func(id, comp1, *comp2);
+template <typename... Components, typename... Excluded, typename Func>
+void Registry::view(Exclude<Excluded...>, Func &&func)
+{
+    static_assert(sizeof...(Components) > 0, "view needs at least one component type");
+    
+    const auto *driver = smallestEntityList<Components...>();
+    if (!driver)
+        return;
+    
+    const ComponentMask include = componentMask<Components...>();
+    const ComponentMask excluded = componentMask<Excluded...>();
+    
+    const auto storages = std::make_tuple(getStorage<Components>()...);
+    
+    CommandBuffer::Scope scope(_commands);
+    
+    for (EntityId id : *driver)
+    {
+        if (!matches(id, include, excluded))
+            continue;
+        func(id, *std::get<ComponentStorage<Components> *>(storages)->find(id)...);
+    }
+}
+
+template <typename... Components, typename Func>
+void Registry::view(Func &&func) const
+{
+    view<Components...>(exclude<>, std::forward<Func>(func));
+}
+
+template <typename... Components, typename... Excluded, typename Func>
+void Registry::view(Exclude<Excluded...>, Func &&func) const
+{
+    static_assert(sizeof...(Components) > 0, "view needs at least one component type");
+    
+    const auto *driver = smallestEntityList<Components...>();
+    if (!driver)
+        return;
+    
+    const ComponentMask include = componentMask<Components...>();
+    const ComponentMask excluded = componentMask<Excluded...>();
+    
+    const auto storages = std::make_tuple(getStorage<Components>()...);
+    
+    for (EntityId id : *driver)
+    {
+        if (!matches(id, include, excluded))
+            continue;
+        func(id, *std::get<const ComponentStorage<Components> *>(storages)->find(id)...);
+    }
+}
+
+template <typename... Components, typename Func>
+void Registry::parallelChunks(std::size_t grain, const ComponentMask &excluded, Func &&func)
+{
+    static_assert(sizeof...(Components) > 0, "parallelForEach needs at least one component type");
+    
+    const auto *driver = smallestEntityList<Components...>();
+    if (!driver)
+        return;
+    
+    const ComponentMask include = componentMask<Components...>();
+    const auto storages = std::make_tuple(getStorage<Components>()...);
+    
+    CommandBuffer::Scope scope(_commands);
+    
+    const auto body = [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+        const auto &entities = *driver;
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const EntityId id = entities[i];
+            if constexpr (sizeof...(Components) == 1)
+            {
+                // The driver is the storage itself: slot i is the component
+                if (excluded.any() && !matches(id, include, excluded))
+                    continue;
+                func(chunk, id, std::get<0>(storages)->at(i));
             }
-        }
-    } else {
-        for (auto &[id, comp2] : storage2->components) {
-            auto *comp1 = getComponent<C1>(id);
-            if (comp1) {
-                func(id, *comp1, comp2);
+            else
+            {
+                if (!matches(id, include, excluded))
+                    continue;
+                func(chunk, id, *std::get<ComponentStorage<Components> *>(storages)->find(id)...);
             }
         }
-    }
+    };
+    
+    if (_jobs)
+        _jobs->parallelFor(0, driver->size(), grain, body);
+    else
+        body(0, driver->size(), 0);
 }
 
-template <typename C1, typename C2, typename C3, typename Func>
-void Registry::view(Func &&func)
+template <typename... Components, typename Func>
+void Registry::parallelForEach(Func &&func, std::size_t grain)
 {
-    forEach<C1>([&](EntityId id, C1 &comp1) {
-        auto *comp2 = getComponent<C2>(id);
-        auto *comp3 = getComponent<C3>(id);
-        if (comp2 && comp3) {
-            func(id, comp1, *comp2, *comp3);
-        }
+    parallelForEach<Components...>(exclude<>, std::forward<Func>(func), grain);
+}
+
+template <typename... Components, typename... Excluded, typename Func>
+void Registry::parallelForEach(Exclude<Excluded...>, Func &&func, std::size_t grain)
+{
+    parallelChunks<Components...>(grain, componentMask<Excluded...>(), [&func](std::size_t, EntityId id, Components &...components) {
+        func(id, components...);
     });
 }
 
-template <typename C1, typename C2, typename Func>
-void Registry::view(Func &&func) const
+template <typename Component, typename... Others, typename Func>
+void Registry::parallelPatch(Func &&func, std::size_t grain)
 {
-    forEach<C1>([&](EntityId id, const C1 &comp1) {
-        const auto *comp2 = getComponent<C2>(id);
-        if (comp2) {
-            func(id, comp1, *comp2);
-        }
+    parallelPatch<Component, Others...>(exclude<>, std::forward<Func>(func), grain);
+}
+
+template <typename Component, typename... Others, typename... Excluded, typename Func>
+void Registry::parallelPatch(Exclude<Excluded...> excluded, Func &&func, std::size_t grain)
+{
+    const ComponentTypeId typeId = componentTypeId<Component>();
+    if (!_trackedComponents.test(typeId))
+    {
+        parallelForEach<Component, Others...>(excluded, func, grain);
+        return;
+    }
+    
+    // One list per chunk, merged in chunk order so marks follow iteration order
+    std::pmr::vector<std::pmr::vector<EntityId>> touched(_jobs ? _jobs->maxChunks() : 1, _resource);
+    parallelChunks<Component, Others...>(grain, componentMask<Excluded...>(), [&func, &touched](std::size_t chunk, EntityId id, Component &component, Others &...others) {
+        if (func(id, component, others...))
+            touched[chunk].push_back(id);
     });
+    
+    ChangeSet &changes = *_changeSets[typeId];
+    for (const auto &chunk : touched)
+    {
+        for (EntityId id : chunk)
+            changes.mark(id);
+    }
 }
 
+// ========== Deferred Commands ==========
+
+template <typename Component>
+void CommandBuffer::AddCommand<Component>::apply(Registry &registry)
+{
+    if (registry.entityExists(id))
+        registry.addComponent<Component>(id, std::move(component));
 }
 
+template <typename Component>
+void CommandBuffer::RemoveCommand<Component>::apply(Registry &registry)
+{
+    registry.removeComponent<Component>(id);
+}
 
+}
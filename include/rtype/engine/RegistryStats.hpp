@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** RegistryStats - Memory and occupancy snapshot of a Registry
+*/
+
+#pragma once
+
+#include "rtype/engine/ComponentType.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rtype::engine
+{
+
+/**
+ * @brief Occupancy of one component storage
+ *
+ * Byte counts cover the storage arrays only (values, owners, sparse index),
+ * not heap memory the components themselves point to.
+ */
+struct StorageStats
+{
+    ComponentTypeId typeId{0};
+    const char *typeName{""};   ///< typeid name, mangled on GCC/Clang
+    const char *backend{""};    ///< "dense", "small-map" or "tag"
+    std::size_t count{0};       ///< Components stored
+    std::size_t capacity{0};    ///< Components that fit before the next reallocation
+    std::size_t sparseSize{0};  ///< Entity slots covered by the sparse index (0 without one)
+    std::size_t bytesUsed{0};
+    std::size_t bytesReserved{0};
+
+    /// Share of the reserved dense slots actually holding a component
+    double loadFactor() const
+    {
+        return capacity ? static_cast<double>(count) / static_cast<double>(capacity) : 0.0;
+    }
+
+    /// Share of the sparse index pointing nowhere (entity slots without this component)
+    double fragmentation() const
+    {
+        return sparseSize ? 1.0 - static_cast<double>(count) / static_cast<double>(sparseSize) : 0.0;
+    }
+};
+
+/**
+ * @brief Snapshot returned by Registry::stats()
+ *
+ * Entity bookkeeping (slots, generations, signatures, free list) is reported
+ * apart from the component storages; total*() add both.
+ */
+struct RegistryStats
+{
+    std::size_t liveEntities{0};
+    std::size_t entitySlots{0};      ///< Slots ever handed out (live + free)
+    std::size_t freeSlots{0};        ///< Slots waiting in the free list
+    std::size_t pendingCommands{0};
+    std::size_t groups{0};
+    std::size_t trackedChanges{0};   ///< Entries across every change list
+    std::uint64_t tick{0};           ///< Simulation ticks completed
+    std::size_t bookkeepingBytesUsed{0};
+    std::size_t bookkeepingBytesReserved{0};
+    std::vector<StorageStats> storages;
+
+    std::size_t totalBytesUsed() const
+    {
+        std::size_t total = bookkeepingBytesUsed;
+        for (const auto &storage : storages)
+            total += storage.bytesUsed;
+        return total;
+    }
+
+    std::size_t totalBytesReserved() const
+    {
+        std::size_t total = bookkeepingBytesReserved;
+        for (const auto &storage : storages)
+            total += storage.bytesReserved;
+        return total;
+    }
+};
+
+/**
+ * @brief used/reserved bytes of a vector
+ */
+template <typename Vector>
+void accumulateBytes(const Vector &vector, std::size_t &used, std::size_t &reserved)
+{
+    used += vector.size() * sizeof(typename Vector::value_type);
+    reserved += vector.capacity() * sizeof(typename Vector::value_type);
+}
+
+}
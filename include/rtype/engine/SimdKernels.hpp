@@ -0,0 +1,128 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** SimdKernels - Hot loops bound at startup to the best instruction set
+*/
+
+#pragma once
+
+#include "rtype/engine/CpuFeatures.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rtype::engine
+{
+
+/// Axis-aligned rectangle, inclusive on every side
+struct Bounds
+{
+    float minX;
+    float minY;
+    float maxX;
+    float maxY;
+};
+
+/**
+ * @brief One implementation of every vectorized kernel, for one SimdLevel
+ *
+ * All variants give bit-identical results: they evaluate the same
+ * expressions in the same order (no FMA), so switching level never changes
+ * the simulation. Inputs need no particular alignment. Index outputs are
+ * written in ascending order and must have room for count entries.
+ */
+struct SimdKernels
+{
+    SimdLevel level;
+
+    /**
+     * @brief position[i] += velocity[i] * deltaTime for i in [0, lanes)
+     *
+     * Lanes are plain floats: SoA columns (x[] with vx[]) or packed {x, y}
+     * structs read as floats, as long as lane i of both arrays belongs to
+     * the same entity.
+     */
+    void (*integrate)(float *position, const float *velocity, std::size_t lanes, float deltaTime);
+
+    /**
+     * @brief Indices of the points strictly outside bounds
+     * @param points count packed {x, y} pairs
+     * @return Number of indices written to outside
+     */
+    std::size_t (*outsideBounds)(const float *points, std::size_t count, Bounds bounds, std::uint32_t *outside);
+
+    /**
+     * @brief Indices i whose circle (xs[i], ys[i], radii[i]) overlaps circle (x, y, radius)
+     *
+     * Overlap is dx * dx + dy * dy < (radius + radii[i])^2 with dx = x - xs[i].
+     * @return Number of indices written to hits
+     */
+    std::size_t (*circleOverlaps)(float x, float y, float radius, const float *xs, const float *ys, const float *radii,
+                                  std::size_t count, std::uint32_t *hits);
+
+    /**
+     * @brief Indices i whose circle overlaps a circle of radius moving from (x0, y0) to (x1, y1)
+     *
+     * Swept form of circleOverlaps(): the moving circle covers a capsule, and
+     * circle i is hit when its center is closer than radius + radii[i] to
+     * the segment. A zero-length segment tests the circle at (x0, y0).
+     * @return Number of indices written to hits
+     */
+    std::size_t (*sweptCircleOverlaps)(float x0, float y0, float x1, float y1, float radius, const float *xs, const float *ys,
+                                       const float *radii, std::size_t count, std::uint32_t *hits);
+
+    /**
+     * @brief Indices i whose circle overlaps the beam starting at (x, y), length long to the right
+     *
+     * Overlap is xs[i] - radii[i] <= length + x, xs[i] + radii[i] >= x and
+     * |ys[i] - y| <= halfHeight + radii[i], i.e. the circle's bounding box
+     * touches the beam's rectangle.
+     * @return Number of indices written to hits
+     */
+    std::size_t (*beamOverlaps)(float x, float y, float length, float halfHeight, const float *xs, const float *ys,
+                                const float *radii, std::size_t count, std::uint32_t *hits);
+};
+
+/**
+ * @brief Kernels in use; the best level detectSimdLevel() allows until selectSimdKernels() is called
+ */
+const SimdKernels &simdKernels();
+
+/**
+ * @brief Bind the kernels of a level, clamped to what the CPU supports
+ * @return The level actually bound
+ *
+ * Meant for startup (or A/B runs), before systems use the kernels.
+ */
+SimdLevel selectSimdKernels(SimdLevel requested);
+
+inline void integrate(float *position, const float *velocity, std::size_t lanes, float deltaTime)
+{
+    simdKernels().integrate(position, velocity, lanes, deltaTime);
+}
+
+inline std::size_t outsideBounds(const float *points, std::size_t count, Bounds bounds, std::uint32_t *outside)
+{
+    return simdKernels().outsideBounds(points, count, bounds, outside);
+}
+
+inline std::size_t circleOverlaps(float x, float y, float radius, const float *xs, const float *ys, const float *radii,
+                                  std::size_t count, std::uint32_t *hits)
+{
+    return simdKernels().circleOverlaps(x, y, radius, xs, ys, radii, count, hits);
+}
+
+inline std::size_t sweptCircleOverlaps(float x0, float y0, float x1, float y1, float radius, const float *xs, const float *ys,
+                                       const float *radii, std::size_t count, std::uint32_t *hits)
+{
+    return simdKernels().sweptCircleOverlaps(x0, y0, x1, y1, radius, xs, ys, radii, count, hits);
+}
+
+inline std::size_t beamOverlaps(float x, float y, float length, float halfHeight, const float *xs, const float *ys,
+                                const float *radii, std::size_t count, std::uint32_t *hits)
+{
+    return simdKernels().beamOverlaps(x, y, length, halfHeight, xs, ys, radii, count, hits);
+}
+
+}
@@ -0,0 +1,187 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** SpatialIndex - Per-tick index of entity circles shared by every system
+*/
+
+#pragma once
+
+#include "rtype/common/Types.hpp"
+#include "rtype/engine/Entity.hpp"
+#include "rtype/engine/UniformGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <vector>
+
+namespace rtype::engine
+{
+
+/**
+ * @brief Entity circles bucketed in a UniformGrid, answering range queries
+ *
+ * Filled once per tick with insert() and build(), then read by any number
+ * of systems (queries are const and safe to run concurrently).
+ * Queries report the id of every circle that touches the queried shape,
+ * each one once, in grid order; a circle touches a shape when the distance
+ * from its center to the shape is below its radius.
+ *
+ * The index is a snapshot: ids may have been destroyed and positions may
+ * have moved since build(), so callers still look components up through
+ * the registry.
+ */
+class SpatialIndex
+{
+public:
+    static constexpr float kMaxCellsPerAxis = 64.0f;
+
+    explicit SpatialIndex(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+    /// Queue a circle for the next build(); queries keep seeing the last build
+    void insert(EntityId id, float x, float y, float radius);
+
+    /**
+     * @brief Replace the index with the circles inserted since the last build()
+     * @param area Region the cells tile; circles outside it are still found
+     * @param cellSize Side of a cell; 0 picks twice the largest radius,
+     *        with at most kMaxCellsPerAxis cells along the longest side
+     */
+    void build(Bounds area, float cellSize = 0.0f);
+
+    /// Circles touching the circle (x, y, radius)
+    template <typename Func>
+    void queryRadius(float x, float y, float radius, Func &&func) const;
+
+    /// Circles touching the box
+    template <typename Func>
+    void queryAABB(Bounds box, Func &&func) const;
+
+    /// Circles touching the segment from (x0, y0) to (x1, y1)
+    template <typename Func>
+    void querySegment(float x0, float y0, float x1, float y1, Func &&func) const;
+
+    /**
+     * @brief Circle whose center is closest to (x, y), among those filter accepts
+     * @param maxDistance Centers farther than this are ignored
+     * @return kNullEntity when no circle qualifies
+     */
+    template <typename Filter>
+    EntityId nearest(float x, float y, float maxDistance, Filter &&filter) const;
+
+    EntityId nearest(float x, float y, float maxDistance = std::numeric_limits<float>::infinity()) const
+    {
+        return nearest(x, y, maxDistance, [](EntityId) { return true; });
+    }
+
+    std::size_t size() const { return _grid.size(); }
+    const UniformGrid &grid() const { return _grid; }
+
+private:
+    /// Circles inserted since the last build()
+    std::pmr::vector<EntityId> _ids;
+    std::pmr::vector<float> _x;
+    std::pmr::vector<float> _y;
+    std::pmr::vector<float> _radius;
+
+    std::pmr::vector<EntityId> _builtIds;  ///< _ids as of the last build()
+    Bounds _area{0.0f, 0.0f, 0.0f, 0.0f};
+    UniformGrid _grid;
+};
+
+// ========== Template Implementations ==========
+
+template <typename Func>
+void SpatialIndex::queryRadius(float x, float y, float radius, Func &&func) const
+{
+    _grid.query(Bounds{x - radius, y - radius, x + radius, y + radius}, [&](const UniformGrid::Slice &cells) {
+        for (std::size_t i = 0; i < cells.count; ++i)
+        {
+            const float dx = cells.x[i] - x;
+            const float dy = cells.y[i] - y;
+            const float reach = cells.radius[i] + radius;
+            if (dx * dx + dy * dy < reach * reach)
+                func(_builtIds[cells.items[i]]);
+        }
+    });
+}
+
+template <typename Func>
+void SpatialIndex::queryAABB(Bounds box, Func &&func) const
+{
+    _grid.query(box, [&](const UniformGrid::Slice &cells) {
+        for (std::size_t i = 0; i < cells.count; ++i)
+        {
+            const float dx = cells.x[i] - std::clamp(cells.x[i], box.minX, box.maxX);
+            const float dy = cells.y[i] - std::clamp(cells.y[i], box.minY, box.maxY);
+            if (dx * dx + dy * dy < cells.radius[i] * cells.radius[i])
+                func(_builtIds[cells.items[i]]);
+        }
+    });
+}
+
+template <typename Func>
+void SpatialIndex::querySegment(float x0, float y0, float x1, float y1, Func &&func) const
+{
+    const float sx = x1 - x0;
+    const float sy = y1 - y0;
+    const float lengthSquared = sx * sx + sy * sy;
+    const Bounds box{std::min(x0, x1), std::min(y0, y1), std::max(x0, x1), std::max(y0, y1)};
+
+    _grid.query(box, [&](const UniformGrid::Slice &cells) {
+        for (std::size_t i = 0; i < cells.count; ++i)
+        {
+            // Closest point of the segment to the center
+            float t = lengthSquared > 0.0f ? ((cells.x[i] - x0) * sx + (cells.y[i] - y0) * sy) / lengthSquared : 0.0f;
+            t = std::clamp(t, 0.0f, 1.0f);
+            const float dx = cells.x[i] - (x0 + t * sx);
+            const float dy = cells.y[i] - (y0 + t * sy);
+            if (dx * dx + dy * dy < cells.radius[i] * cells.radius[i])
+                func(_builtIds[cells.items[i]]);
+        }
+    });
+}
+
+template <typename Filter>
+EntityId SpatialIndex::nearest(float x, float y, float maxDistance, Filter &&filter) const
+{
+    if (_grid.size() == 0 || !(maxDistance >= 0.0f))
+        return kNullEntity;
+
+    // Search squares of growing size; the best center within the inscribed
+    // circle of a square cannot be beaten by one outside the square
+    const float areaSize = std::max({_area.maxX - _area.minX, _area.maxY - _area.minY, 0.0f});
+    const float farthest = areaSize + std::abs(x - _area.minX) + std::abs(y - _area.minY);
+    float reach = std::min(_grid.cellSize(), maxDistance);
+
+    for (;;)
+    {
+        EntityId best = kNullEntity;
+        float bestSquared = maxDistance * maxDistance;
+        _grid.query(Bounds{x - reach, y - reach, x + reach, y + reach}, [&](const UniformGrid::Slice &cells) {
+            for (std::size_t i = 0; i < cells.count; ++i)
+            {
+                const float dx = cells.x[i] - x;
+                const float dy = cells.y[i] - y;
+                const float squared = dx * dx + dy * dy;
+                if (squared > bestSquared || (squared == bestSquared && best != kNullEntity))
+                    continue;
+                const EntityId id = _builtIds[cells.items[i]];
+                if (!filter(id))
+                    continue;
+                best = id;
+                bestSquared = squared;
+            }
+        });
+
+        const bool settled = best != kNullEntity && bestSquared <= reach * reach;
+        if (settled || reach >= maxDistance || reach >= farthest)
+            return best;
+        reach = std::min(reach * 2.0f, maxDistance);
+    }
+}
+
+}
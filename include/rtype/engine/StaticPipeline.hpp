@@ -0,0 +1,222 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** StaticPipeline - Compile-time list of systems run without virtual dispatch
+*/
+
+#pragma once
+
+#include "rtype/engine/SystemPipeline.hpp"
+#include "rtype/common/GameConfig.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace rtype::engine
+{
+
+/**
+ * @brief Systems fixed at compile time, run in template argument order
+ *
+ * Counterpart of SystemPipeline for a known set of systems: they live by
+ * value in a std::tuple and update() calls each one through a qualified,
+ * non-virtual call, so nothing goes through the vtable or a pointer and the
+ * compiler (with LTO when systems are defined in other translation units)
+ * can inline across them. Each system can still be switched off at runtime
+ * and decimated exactly like in SystemPipeline (see SystemRate), and the
+ * same SystemProfiler entries are kept so both pipelines can be compared.
+ *
+ * Every system runs on the calling thread; use SystemPipeline to run
+ * independent systems in parallel stages.
+ *
+ * @tparam Systems Distinct ISystem subclasses constructible from a GameConfig
+ */
+template <typename... Systems>
+class StaticPipeline
+{
+public:
+    static constexpr std::size_t kSystemCount = sizeof...(Systems);
+
+    explicit StaticPipeline(const config::GameConfig &config);
+
+    StaticPipeline(const StaticPipeline &) = delete;
+    StaticPipeline &operator=(const StaticPipeline &) = delete;
+
+    /**
+     * @brief Run every enabled system due on this tick
+     * @param registry The ECS registry, whose tick() is advanced once every system ran
+     */
+    void update(float deltaTime, int &currentLevel, Registry &registry, DestroyQueue &toDestroy);
+
+    template <typename System>
+    System &get() { return std::get<System>(_systems); }
+
+    template <typename System>
+    const System &get() const { return std::get<System>(_systems); }
+
+    /**
+     * @brief Switch a system on or off; disabled systems are skipped entirely
+     */
+    template <typename System>
+    void setEnabled(bool enabled) { _enabled[indexOf<System>()] = enabled; }
+
+    template <typename System>
+    bool enabled() const { return _enabled[indexOf<System>()]; }
+
+    bool enabled(std::size_t index) const { return _enabled[index]; }
+
+    /**
+     * @brief Override the declared rate of a system
+     * @param name Class name of the system, qualified or not (e.g. "LevelSystem")
+     * @return false when no system has that name
+     */
+    bool setRate(std::string_view name, SystemRate rate);
+
+    /// Rate a system currently runs at, with its phase resolved
+    SystemRate rate(std::size_t index) const { return SystemRate{_cadence[index].divisor(), _cadence[index].phase}; }
+
+    const std::string &systemName(std::size_t index) const { return _names[index]; }
+
+    constexpr std::size_t systemCount() const { return kSystemCount; }
+
+    /**
+     * @brief Latency histograms: one entry per system in template order, then the whole tick
+     */
+    SystemProfiler &profiler() { return _profiler; }
+    const SystemProfiler &profiler() const { return _profiler; }
+
+private:
+    template <typename System>
+    static constexpr std::size_t indexOf()
+    {
+        constexpr std::array<bool, kSystemCount> matches{std::is_same_v<System, Systems>...};
+        for (std::size_t i = 0; i < kSystemCount; ++i)
+        {
+            if (matches[i])
+                return i;
+        }
+        return kSystemCount;
+    }
+
+    template <std::size_t... Indices>
+    static constexpr bool distinct(std::index_sequence<Indices...>)
+    {
+        return ((indexOf<std::tuple_element_t<Indices, std::tuple<Systems...>>>() == Indices) && ...);
+    }
+
+    /// Forwards the config once per system when building the tuple
+    template <typename>
+    using ConfigRef = const config::GameConfig &;
+
+    template <std::size_t... Indices>
+    void runAll(std::index_sequence<Indices...>, int &currentLevel, Registry &registry, DestroyQueue &toDestroy);
+
+    template <std::size_t Index>
+    void runSystem(int &currentLevel, Registry &registry, DestroyQueue &toDestroy);
+
+    std::tuple<Systems...> _systems;
+    std::array<bool, kSystemCount> _enabled;
+    std::array<SystemCadence, kSystemCount> _cadence{};
+    std::array<std::string, kSystemCount> _names;
+
+    SystemProfiler _profiler;
+    std::size_t _tickEntry{0};
+};
+
+// ========== Template Implementations ==========
+
+template <typename... Systems>
+StaticPipeline<Systems...>::StaticPipeline(const config::GameConfig &config)
+    : _systems(static_cast<ConfigRef<Systems>>(config)...),
+      _names{prettyTypeName(typeid(Systems).name())...}
+{
+    static_assert(distinct(std::index_sequence_for<Systems...>{}), "StaticPipeline: a system type is listed twice");
+    static_assert((std::is_base_of_v<ISystem, Systems> && ...), "StaticPipeline: every system must derive from ISystem");
+
+    _enabled.fill(true);
+    std::size_t index = 0;
+    ((_cadence[index++].requested = std::get<Systems>(_systems).Systems::rate()), ...);
+    resolvePhases(_cadence);
+
+    for (const auto &name : _names)
+        _profiler.addEntry(name);
+    _tickEntry = _profiler.addEntry("tick");
+}
+
+template <typename... Systems>
+bool StaticPipeline<Systems...>::setRate(std::string_view name, SystemRate rate)
+{
+    bool found = false;
+    for (std::size_t i = 0; i < kSystemCount; ++i)
+    {
+        if (!matchesSystemName(_names[i], name))
+            continue;
+
+        _cadence[i].requested = rate;
+        found = true;
+    }
+
+    if (found)
+        resolvePhases(_cadence);
+    return found;
+}
+
+template <typename... Systems>
+void StaticPipeline<Systems...>::update(float deltaTime, int &currentLevel, Registry &registry, DestroyQueue &toDestroy)
+{
+    const auto tickStart = SystemProfiler::Clock::now();
+
+    const std::uint64_t tick = registry.tick();
+    for (auto &cadence : _cadence)
+        cadence.beginTick(tick, deltaTime);
+
+    runAll(std::index_sequence_for<Systems...>{}, currentLevel, registry, toDestroy);
+
+    registry.advanceTick();
+
+    if (_profiler.enabled())
+    {
+        _profiler.record(_tickEntry, SystemProfiler::Clock::now() - tickStart);
+        _profiler.endTick();
+    }
+}
+
+template <typename... Systems>
+template <std::size_t... Indices>
+void StaticPipeline<Systems...>::runAll(std::index_sequence<Indices...>, int &currentLevel, Registry &registry, DestroyQueue &toDestroy)
+{
+    (runSystem<Indices>(currentLevel, registry, toDestroy), ...);
+}
+
+template <typename... Systems>
+template <std::size_t Index>
+void StaticPipeline<Systems...>::runSystem(int &currentLevel, Registry &registry, DestroyQueue &toDestroy)
+{
+    using System = std::tuple_element_t<Index, std::tuple<Systems...>>;
+
+    SystemCadence &cadence = _cadence[Index];
+    if (!_enabled[Index] || !cadence.due)
+        return;
+
+    const float deltaTime = cadence.consume();
+    System &system = std::get<Index>(_systems);
+
+    if (!_profiler.enabled())
+    {
+        system.System::update(deltaTime, currentLevel, registry, toDestroy);
+        return;
+    }
+
+    const auto start = SystemProfiler::Clock::now();
+    system.System::update(deltaTime, currentLevel, registry, toDestroy);
+    _profiler.record(Index, SystemProfiler::Clock::now() - start);
+}
+
+}
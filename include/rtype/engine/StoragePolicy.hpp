@@ -0,0 +1,52 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** StoragePolicy - Compile-time choice of a component storage backend
+*/
+
+#pragma once
+
+#include <type_traits>
+
+namespace rtype::engine
+{
+
+/// Sparse set with a dense value array: for components most entities carry
+struct DenseStorage
+{
+};
+
+/// Flat (entity, value) arrays searched linearly: for components on a handful of entities
+struct SmallMapStorage
+{
+};
+
+/// Sparse set without values: for empty marker components
+struct TagStorage
+{
+};
+
+/**
+ * @brief Storage backend used for a component type
+ *
+ * Empty types default to TagStorage, everything else to DenseStorage.
+ * Specialize to pick another backend, e.g.
+ *
+ *   template <>
+ *   struct StoragePolicy<Boss2Behavior> { using type = SmallMapStorage; };
+ *
+ * The specialization must be visible wherever the component is stored. Game
+ * components get theirs in ComponentStoragePolicies.hpp, which Registry.hpp
+ * includes, so rtype/common headers stay free of engine types.
+ */
+template <typename Component>
+struct StoragePolicy
+{
+    using type = std::conditional_t<std::is_empty_v<Component>, TagStorage, DenseStorage>;
+};
+
+template <typename Component>
+using StoragePolicyOf = typename StoragePolicy<std::remove_cv_t<Component>>::type;
+
+}
@@ -6,23 +6,93 @@
 */
 
 #pragma once
+#include <algorithm>
 #include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include "rtype/engine/Registry.hpp"
 #include "rtype/engine/ISystem.hpp"
+#include "rtype/engine/JobSystem.hpp"
+#include "rtype/engine/SystemProfiler.hpp"
 
 namespace rtype::engine
 {
 
+/**
+ * @brief Decimation state of one pipeline slot (see SystemRate)
+ */
+struct SystemCadence
+{
+    SystemRate requested;
+    std::uint32_t phase{0};
+    float pendingDt{0.0f};
+    bool due{false};
+    bool ran{false};
+
+    std::uint32_t divisor() const { return std::max<std::uint32_t>(requested.divisor, 1); }
+
+    /// Accumulate the tick's dt and decide whether the system runs on it
+    void beginTick(std::uint64_t tick, float deltaTime)
+    {
+        pendingDt += deltaTime;
+        due = tick % divisor() == phase;
+    }
+
+    /// dt to hand the system now that it runs: everything since its last run
+    float consume()
+    {
+        ran = true;
+        return std::exchange(pendingDt, 0.0f);
+    }
+};
+
+/**
+ * @brief Give every auto-phased cadence the phase sharing the fewest ticks with the earlier ones
+ */
+void resolvePhases(std::span<SystemCadence> cadences);
+
+/**
+ * @brief Whether name designates the system whose demangled class name is fullName
+ *
+ * Both the qualified and the unqualified name match ("rtype::server::LevelSystem"
+ * or "LevelSystem").
+ */
+bool matchesSystemName(std::string_view fullName, std::string_view name);
+
 
 /**
  * @brief Container for multiple systems that run in sequence
  * 
  * The SystemPipeline allows you to organize and run multiple systems
  * in a specific order each frame.
+ *
+ * With a JobSystem, systems are grouped into stages from their declared
+ * SystemAccess: a system lands in the stage after the last earlier system
+ * it conflicts with, and the systems of one stage run concurrently. Since
+ * conflicting systems keep their registration order, the outcome matches a
+ * sequential run. The first update is always sequential so that groups
+ * created lazily by systems exist before anything runs in parallel.
+ *
+ * Every system update, and the whole tick, is timed into a SystemProfiler
+ * unless profiling is disabled.
+ *
+ * Systems may run below the tick rate (see SystemRate). A system skipped on
+ * a tick simply leaves its slot of the stage empty; when it runs again it
+ * gets the dt accumulated meanwhile. The pipeline stays sequential until
+ * every system ran once, so lazily created groups of decimated systems also
+ * exist before going parallel.
  */
 class SystemPipeline
 {
 public:
+    /**
+     * @param jobs Job system used to run a stage concurrently; null keeps every update sequential
+     */
+    explicit SystemPipeline(JobSystem *jobs = nullptr);
+
     /**
      * @brief Add a system to the pipeline
      * @param system Unique pointer to the system (pipeline takes ownership)
@@ -30,26 +100,81 @@ public:
      * Systems are executed in the order they are added.
      */
     void addSystem(std::unique_ptr<ISystem> system);
+
+    /**
+     * @brief Override the declared rate of a system
+     * @param name Class name of the system, qualified or not (e.g. "LevelSystem")
+     * @return false when no system has that name
+     */
+    bool setRate(std::string_view name, SystemRate rate);
+
+    /**
+     * @brief Rate a system currently runs at, with its phase resolved
+     */
+    SystemRate rate(std::size_t index) const;
+
+    /**
+     * @brief Demangled class name of a system, as used by the profiler
+     */
+    const std::string &systemName(std::size_t index) const;
     
     /**
      * @brief Run all systems in the pipeline
      * @param deltaTime Time elapsed since last update
-     * @param registry The ECS registry
+     * @param registry The ECS registry, whose tick() is advanced once every system ran
      */
-    void update(float deltaTime, int &currentLevel, Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy);
+    void update(float deltaTime, int &currentLevel, Registry &registry, DestroyQueue &toDestroy);
     
     /**
      * @brief Get the number of systems in the pipeline
      */
     std::size_t systemCount() const;
+
+    /**
+     * @brief Number of stages in the current schedule (systemCount() when nothing can overlap)
+     */
+    std::size_t stageCount();
     
     /**
      * @brief Clear all systems from the pipeline
      */
     void clear();
 
+    /**
+     * @brief Latency histograms: one entry per system in registration order, then the whole tick
+     */
+    SystemProfiler &profiler();
+    const SystemProfiler &profiler() const;
+
 private:
+    /**
+     * @brief Rebuild the stages from the systems' declared access
+     */
+    void buildSchedule();
+
+    /**
+     * @brief Run one system if due this tick, with its accumulated dt, timing it when profiling is on
+     */
+    void runSystem(std::size_t index, int &currentLevel, Registry &registry, DestroyQueue &toDestroy);
+
+    /**
+     * @brief Register the profiler entries matching the current systems
+     */
+    void rebuildProfilerEntries();
+
     std::vector<std::unique_ptr<ISystem>> _systems;
+    std::vector<std::string> _names;
+    std::vector<SystemCadence> _cadence;  ///< Indexed like _systems
+    JobSystem *_jobs;
+
+    /// System indices per stage, each stage in registration order
+    std::vector<std::vector<std::size_t>> _stages;
+    bool _scheduleDirty{true};
+    bool _warmedUp{false};
+
+    SystemProfiler _profiler;
+    std::size_t _tickEntry{0};
+    bool _profilerDirty{true};
 };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,132 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** SystemProfiler - Per-system tick latency histograms
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rtype::engine
+{
+
+/**
+ * @brief Log-linear latency histogram (HDR style) over nanoseconds
+ *
+ * Values below 2^kSubBucketBits get one bucket each; above that, every
+ * power of two is split into 2^(kSubBucketBits - 1) buckets, so a recorded
+ * value is known within ~3%. Recording is a bit scan and an increment, and
+ * the whole histogram is a fixed array: nothing allocates after construction.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr unsigned kSubBucketBits = 5;
+    static constexpr unsigned kMaxValueBits = 40;   ///< ~18 minutes, anything longer is clamped
+
+    void record(std::uint64_t nanoseconds);
+    void merge(const LatencyHistogram &other);
+    void reset();
+
+    std::uint64_t count() const { return _count; }
+    std::uint64_t max() const { return _max; }
+
+    /**
+     * @brief Smallest bucket upper bound covering the given fraction of samples
+     * @param quantile In [0, 1], e.g. 0.99 for p99
+     */
+    std::uint64_t percentile(double quantile) const;
+
+private:
+    static constexpr std::size_t kHalfBucket = std::size_t{1} << (kSubBucketBits - 1);
+    static constexpr std::size_t kBucketCount = (kMaxValueBits - kSubBucketBits + 2) * kHalfBucket;
+
+    static std::size_t bucketOf(std::uint64_t value);
+    static std::uint64_t bucketUpperBound(std::size_t bucket);
+
+    std::array<std::uint32_t, kBucketCount> _buckets{};
+    std::uint64_t _count{0};
+    std::uint64_t _max{0};
+};
+
+/**
+ * @brief Latency summary of one profiled entry (times in nanoseconds)
+ */
+struct SystemTiming
+{
+    std::string name;
+    std::uint64_t samples{0};
+    std::uint64_t p50{0};
+    std::uint64_t p95{0};
+    std::uint64_t p99{0};
+    std::uint64_t max{0};
+};
+
+/**
+ * @brief Rolling latency histograms for the systems of one pipeline
+ *
+ * Each entry keeps two histograms: the window being filled and the last
+ * complete one. Every kWindowTicks ticks the current window becomes the
+ * previous one, so a snapshot always covers the last one to two windows.
+ * record() only touches the entry's own histogram, so systems running in
+ * parallel may record concurrently as long as each entry has one writer.
+ */
+class SystemProfiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// 10 s at the 60 Hz server tick
+    static constexpr std::size_t kWindowTicks = 600;
+
+    void setEnabled(bool enabled) { _enabled = enabled; }
+    bool enabled() const { return _enabled; }
+
+    /**
+     * @brief Register an entry and return its index for record()
+     */
+    std::size_t addEntry(std::string name);
+
+    void record(std::size_t entry, Clock::duration elapsed);
+
+    /**
+     * @brief Close a tick, rotating the windows when one is full
+     */
+    void endTick();
+
+    /**
+     * @brief Percentiles of every entry over the previous and current windows
+     */
+    std::vector<SystemTiming> snapshot() const;
+
+    /**
+     * @brief Forget every entry and sample
+     */
+    void clear();
+
+private:
+    struct Entry
+    {
+        std::string name;
+        LatencyHistogram current;
+        LatencyHistogram previous;
+    };
+
+    std::vector<Entry> _entries;
+    std::size_t _ticksInWindow{0};
+    bool _enabled{true};
+};
+
+/**
+ * @brief Human readable name of a type (demangled where the ABI allows it)
+ */
+std::string prettyTypeName(const char *mangled);
+
+}
@@ -0,0 +1,116 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** UniformGrid - Broadphase bucketing circles into square cells
+*/
+
+#pragma once
+
+#include "rtype/engine/SimdKernels.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace rtype::engine
+{
+
+/**
+ * @brief Circles bucketed by the cell holding their center, rebuilt every tick
+ *
+ * build() counting-sorts the circles by cell into SoA columns, so the
+ * circles of a row of cells are one contiguous slice that can be handed
+ * straight to a SimdKernels narrowphase. Each circle is stored once; queries
+ * grow their box by the largest radius instead, so they report every circle
+ * overlapping the box (and some that do not). Positions outside the area
+ * fall in the border cells, which keeps queries exact for them too.
+ */
+class UniformGrid
+{
+public:
+    /// Contiguous candidates: index i is circle items[i] of the build input
+    struct Slice
+    {
+        const float *x;
+        const float *y;
+        const float *radius;
+        const std::uint32_t *items;
+        std::size_t count;
+    };
+
+    explicit UniformGrid(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Replace the contents with count circles
+     * @param area Region the cells tile (clamped to at least one cell)
+     * @param cellSize Side of a cell; about twice the typical radius works well
+     */
+    void build(Bounds area, float cellSize, const float *xs, const float *ys, const float *radii, std::size_t count);
+
+    /**
+     * @brief Call func(Slice) for every row of cells that may hold a circle overlapping box
+     */
+    template <typename Func>
+    void query(Bounds box, Func &&func) const;
+
+    std::size_t size() const { return _items.size(); }
+    std::size_t columns() const { return _columns; }
+    std::size_t rows() const { return _rows; }
+    float cellSize() const { return _cellSize; }
+    float maxRadius() const { return _maxRadius; }
+
+private:
+    std::size_t columnOf(float x) const { return cellIndex((x - _area.minX) * _inverseCell, _columns); }
+    std::size_t rowOf(float y) const { return cellIndex((y - _area.minY) * _inverseCell, _rows); }
+
+    /// Cell holding a coordinate already scaled to cells, clamped to [0, cells)
+    static std::size_t cellIndex(float cell, std::size_t cells)
+    {
+        if (!(cell >= 1.0f))  // also catches NaN
+            return 0;
+        return std::min(static_cast<std::size_t>(std::min(cell, static_cast<float>(cells))), cells - 1);
+    }
+
+    Bounds _area{0.0f, 0.0f, 0.0f, 0.0f};
+    float _cellSize{1.0f};
+    float _inverseCell{1.0f};
+    float _maxRadius{0.0f};
+    std::size_t _columns{0};
+    std::size_t _rows{0};
+
+    std::pmr::vector<std::uint32_t> _cellStart;  ///< Per cell, first slot; one extra end entry
+    std::pmr::vector<std::uint32_t> _cellOf;     ///< Cell of each input circle, during build()
+    std::pmr::vector<float> _x;
+    std::pmr::vector<float> _y;
+    std::pmr::vector<float> _radius;
+    std::pmr::vector<std::uint32_t> _items;
+};
+
+// ========== Template Implementations ==========
+
+template <typename Func>
+void UniformGrid::query(Bounds box, Func &&func) const
+{
+    if (_items.empty())
+        return;
+
+    const std::size_t firstColumn = columnOf(box.minX - _maxRadius);
+    const std::size_t lastColumn = columnOf(box.maxX + _maxRadius);
+    const std::size_t firstRow = rowOf(box.minY - _maxRadius);
+    const std::size_t lastRow = rowOf(box.maxY + _maxRadius);
+
+    for (std::size_t row = firstRow; row <= lastRow; ++row)
+    {
+        const std::size_t begin = _cellStart[row * _columns + firstColumn];
+        const std::size_t end = _cellStart[row * _columns + lastColumn + 1];
+        if (begin == end)
+            continue;
+
+        func(Slice{_x.data() + begin, _y.data() + begin, _radius.data() + begin, _items.data() + begin, end - begin});
+    }
+}
+
+}
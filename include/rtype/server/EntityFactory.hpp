@@ -25,7 +25,8 @@ public:
 
     EntityId spawnMonster(std::uint8_t type, bool canShoot, Team team, float x, float y, float vx, float vy);
 
-    EntityId spawnShield(EntityId parentMonster, std::uint8_t type, float x, float y, float vx, float vy);
+    // team is the parent's: its components may still be deferred when spawned mid-iteration
+    EntityId spawnShield(EntityId parentMonster, Team team, std::uint8_t type, float x, float y, float vx, float vy);
 
     EntityId spawnBullet(EntityId owner, bool fromPlayer, float x, float y, float vx, float vy,
                                         WeaponType weaponType, std::uint8_t damage);
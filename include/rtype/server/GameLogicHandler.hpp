@@ -10,19 +10,29 @@
 
 #include "rtype/engine/Registry.hpp"
 #include "rtype/engine/SystemPipeline.hpp"
+#include "rtype/engine/JobSystem.hpp"
+#include "rtype/engine/DestroyQueue.hpp"
+#include "rtype/engine/SpatialIndex.hpp"
 #include "rtype/common/Types.hpp"
 #include "rtype/common/GameConfig.hpp"
 #include "rtype/common/Components.hpp"
 #include "rtype/common/Protocol.hpp"
 #include "rtype/server/EntityFactory.hpp"
-#include <unordered_set>
+#include "rtype/server/GameSystems.hpp"
+#include <memory>
+#include <memory_resource>
 #include <random>
 
 namespace rtype::server
 {
 class GameLogicHandler {
     public:
-        GameLogicHandler(config::GameConfig config);
+        /**
+         * @param resource Memory the registry allocates from (must outlive the handler)
+         * @param jobs Job system shared by the pipeline and parallel loops (null = sequential)
+         */
+        GameLogicHandler(config::GameConfig config, std::pmr::memory_resource *resource = std::pmr::get_default_resource(),
+            engine::JobSystem *jobs = nullptr);
         ~GameLogicHandler();
         EntityId spawnPlayer(PlayerId player_id);
         // void managePlayerMovement(const net::PlayerInput &input, const EntityId entity);
@@ -30,24 +40,31 @@ class GameLogicHandler {
         void updateGame(const float dt);
         void destroyEntity(rtype::EntityId id);
         const engine::Registry &getRegistry() const;
+        std::vector<engine::SystemTiming> getSystemTimings() const;
         engine::Registry &getRegistry();
         void markDestroy(EntityId id);
         void destroyEntityDestructionList();
-        const std::unordered_set<rtype::EntityId> &getEntityDestructionSet();
+        const engine::DestroyQueue &getEntityDestructionSet();
         int getCurrentLevel() const;
         bool hasLevelChanged();
 
     protected:
     private:
         void initializeSystems();
+        void initializeStaticPipeline();
+        void spawnDefaultMonsters();
+        template <typename Pipeline>
+        void applySystemRates(Pipeline &pipeline);
         int _prevLevel{0};
         int _currentLevel{0};
         bool _levelChanged{false};
         config::GameConfig _config;
+        engine::SpatialIndex _spatialIndex;  ///< Rebuilt by SpatialIndexSystem, installed in _registry
         engine::Registry _registry;
         EntityFactory _entityFactory;
         engine::SystemPipeline _systemPipeline;
-        std::unordered_set<EntityId> toDestroySet;
+        std::unique_ptr<StaticGamePipeline> _staticPipeline;  ///< Replaces _systemPipeline when set
+        engine::DestroyQueue toDestroySet;
 };
 }
 #endif /* !GAMELOGICHANDLER_HPP_ */
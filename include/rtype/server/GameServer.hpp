@@ -4,6 +4,7 @@
 #include "rtype/common/Protocol.hpp"
 #include "rtype/common/GameConfig.hpp"
 #include "rtype/common/INetwork.hpp"
+#include "rtype/engine/FixedTimestep.hpp"
 #include "rtype/server/GameLogicHandler.hpp"
 #include "rtype/server/RoomManager.hpp"
 #include "ClientHandler.hpp"
@@ -44,6 +45,7 @@ private:
     void updateGameLoop();
     void broadcastRoomStates(Timestamp timestamp);
     void checkClientTimeouts();
+    void maybeDumpRoomStats(float dt);
     void flushSends(const std::vector<std::uint8_t> &data, const network::IEndpoint &target);
     PlayerInputComponent translateNetworkInput(const net::PlayerInput &input);
     Timestamp nowMilliseconds() const;
@@ -64,6 +66,9 @@ private:
     config::GameConfig _config;
     std::unique_ptr<RoomManager> _roomManager;
 
+    /// Turns measured frame time into fixed simulation ticks ([SystemParameters] FixedTimestep)
+    engine::FixedTimestep _timestep;
+
     struct PendingPacket
     {
         std::vector<std::uint8_t> data;
@@ -74,6 +79,11 @@ private:
     std::vector<PendingPacket> _rxQueue;
 
     SequenceNumber _sequence{1};
+    std::uint64_t _broadcastCount{0};
+    float _statsDumpTimer{0.0f};
+
+    /// Every Nth broadcast re-sends every entity, healing lost UDP updates
+    static constexpr std::uint64_t kFullStateInterval = 30;
     PlayerId _nextPlayerId{0};
 };
 }
@@ -14,6 +14,7 @@
 #include "rtype/server/systems/ShootingSystem.hpp"
 #include "rtype/server/systems/WeaponDamageSystem.hpp"
 #include "rtype/server/systems/ProjectileLifetimeSystem.hpp"
+#include "rtype/server/systems/ProjectileSystem.hpp"
 #include "rtype/server/systems/FireCooldownSystem.hpp"
 #include "rtype/server/systems/CleanupSystem.hpp"
 #include "rtype/server/systems/LevelSystem.hpp"
@@ -22,4 +23,34 @@
 #include "rtype/server/systems/Boss2BehaviorSystem.hpp"
 #include "rtype/server/systems/ShieldFollowSystem.hpp"
 #include "rtype/server/systems/PowerUpSystem.hpp"
+#include "rtype/server/systems/SpatialIndexSystem.hpp"
+#include "rtype/engine/StaticPipeline.hpp"
 
+namespace rtype::server
+{
+
+/**
+ * @brief Every gameplay system, in the order GameLogicHandler registers them
+ *
+ * Used instead of the dynamic SystemPipeline when [SystemParameters]
+ * StaticPipeline=true; optional systems are switched off at runtime.
+ */
+using StaticGamePipeline = engine::StaticPipeline<
+    MovementSystem,
+    LaserBeamSystem,
+    FireCooldownSystem,
+    ProjectileLifetimeSystem,
+    ProjectileSystem,
+    CollisionSystem,
+    BoundarySystem,
+    CleanupSystem,
+    SpatialIndexSystem,
+    PlayerInputSystem,
+    ShootingSystem,
+    WeaponDamageSystem,
+    PowerUpSystem,
+    LevelSystem,
+    Boss2BehaviorSystem,
+    ShieldFollowSystem>;
+
+}
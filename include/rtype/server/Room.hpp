@@ -12,6 +12,8 @@
 #include "rtype/server/GameLogicHandler.hpp"
 #include "rtype/server/ClientHandler.hpp"
 #include "rtype/common/INetwork.hpp"
+#include "rtype/engine/MemoryArena.hpp"
+#include "rtype/engine/JobSystem.hpp"
 
 #include <unordered_map>
 #include <string>
@@ -34,7 +36,8 @@ enum class RoomState : std::uint8_t
 class Room
 {
 public:
-    explicit Room(RoomId id, PlayerId hostId, const std::string& roomName, const config::GameConfig& config);
+    explicit Room(RoomId id, PlayerId hostId, const std::string& roomName, const config::GameConfig& config,
+        engine::JobSystem* jobs = nullptr);
     ~Room() = default;
 
     RoomId getId() const { return _roomId; }
@@ -53,6 +56,7 @@ public:
     void updateGame(float dt);
     
     GameLogicHandler& getGameLogic() { return _gameLogic; }
+    const GameLogicHandler& getGameLogic() const { return _gameLogic; }
     const std::unordered_map<PlayerId, ClientHandler>& getClients() const { return _clients; }
     std::unordered_map<PlayerId, ClientHandler>& getClients() { return _clients; }
     
@@ -73,6 +77,7 @@ private:
     PlayerId _hostId;
     RoomState _state;
     std::unordered_map<PlayerId, ClientHandler> _clients;
+    engine::MemoryArena _arena;     // Backs the room registry; must outlive _gameLogic
     GameLogicHandler _gameLogic;
     config::GameConfig _config;
     std::unordered_map<PlayerId, bool> _deadPlayers;  // Track which players have died
@@ -9,7 +9,11 @@
 
 #include "rtype/server/Room.hpp"
 #include "rtype/common/Types.hpp"
+#include "rtype/engine/RegistryStats.hpp"
+#include "rtype/engine/SystemProfiler.hpp"
+#include "rtype/engine/JobSystem.hpp"
 
+#include <ostream>
 #include <unordered_map>
 #include <memory>
 #include <mutex>
@@ -29,6 +33,16 @@ struct RoomInfo
     RoomState state;
 };
 
+struct RoomStats
+{
+    RoomId roomId;
+    std::string roomName;
+    std::size_t playerCount;
+    RoomState state;
+    engine::RegistryStats registry;
+    std::vector<engine::SystemTiming> systems;
+};
+
 class RoomManager
 {
 public:
@@ -45,11 +59,28 @@ public:
     void leaveRoom(PlayerId playerId);
     
     std::vector<RoomInfo> listRooms() const;
+    
+    /**
+     * @brief Registry occupancy and system timings of every room, sorted by room id
+     */
+    std::vector<RoomStats> collectRoomStats() const;
+    void dumpRoomStats(std::ostream& out) const;
+    
+    /**
+     * @brief Append one CSV row per room and system (times in microseconds)
+     */
+    void writeSystemTimingsCsv(std::ostream& out, Timestamp now, bool header) const;
     void updateAllRooms(float dt);
     
     void cleanupEmptyRooms();
+    
+    /**
+     * @brief Job system shared by every room, null when WorkerThreads is 0
+     */
+    engine::JobSystem* getJobSystem() { return _jobs.get(); }
 
 private:
+    std::unique_ptr<engine::JobSystem> _jobs;   // Shared by every room; must outlive _rooms
     std::unordered_map<RoomId, std::shared_ptr<Room>> _rooms;
     std::unordered_map<PlayerId, RoomId> _playerToRoom;
     RoomId _nextRoomId{1};
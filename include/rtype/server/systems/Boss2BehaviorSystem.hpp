@@ -20,7 +20,8 @@ class Boss2BehaviorSystem : public engine::ISystem
 public:
     explicit Boss2BehaviorSystem(const config::GameConfig &config)
         : ISystem(config) {}
-    void update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) override;
+    void update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemAccess access() const override;
 
 private:
 };
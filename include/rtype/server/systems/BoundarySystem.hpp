@@ -8,19 +8,32 @@
 #pragma once
 #include "rtype/engine/ISystem.hpp"
 
+#include <cstdint>
+#include <vector>
+
 namespace rtype::server
 {
 
 /**
  * @brief Boundary System - Clamps players to screen, destroys entities outside margins
+ *
+ * Culling scans MovementSystem's packed Transform/Velocity group with
+ * engine::outsideBounds(), so only entities past the margins are looked
+ * up. Entities without a Velocity are never culled; EntityFactory gives
+ * every simulated entity one. Projectiles are part of the group, so with
+ * FusedProjectiles they go through the kernel here as well, and are only
+ * skipped once found outside (ProjectileSystem culls them).
  */
 class BoundarySystem : public engine::ISystem
 {
 public:
     BoundarySystem(const config::GameConfig &config);
-    void update(float, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) override;
+    void update(float, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemAccess access() const override;
 
 private:
     float _worldWidth, _worldHeight, _margin;
+    bool _skipProjectiles;  ///< Projectiles are culled by ProjectileSystem
+    std::vector<std::uint32_t> _outside;  ///< Group slots found outside the margins this tick
 };
 }
\ No newline at end of file
@@ -20,7 +20,8 @@ class CleanupSystem : public engine::ISystem
 public:
     explicit CleanupSystem(const config::GameConfig &config)
         : ISystem(config) {}
-    void update(float, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) override;
+    void update(float, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemAccess access() const override;
 
 private:
 };
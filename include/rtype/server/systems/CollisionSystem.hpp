@@ -9,6 +9,11 @@
 
 #include "rtype/engine/ISystem.hpp"
 #include "rtype/common/Components.hpp"
+#include "rtype/engine/UniformGrid.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
 
 namespace rtype::server
 {
@@ -17,17 +22,60 @@ namespace rtype::server
 /**
  * @brief Collision System - Handles projectile collisions with entities
  * Uses per-entity Collider components for accurate collision detection
+ *
+ * Hurtboxes are copied once per tick into one bucket per CollisionLayer,
+ * each with its own uniform grid over the world (a bucket smaller than
+ * kGridMinHurtboxes skips the grid and is scanned whole). A hitbox only visits the
+ * buckets its layer may hit ([CollisionLayers], plus FriendlyFire), so a
+ * hitbox whose layer hits no populated bucket costs nothing; inside a
+ * bucket it runs the batched narrowphase (engine::circleOverlaps() or
+ * engine::beamOverlaps()) on the rows of cells its bounds reach.
+ *
+ * Circle hitboxes with a PreviousTransform are swept: they are tested as
+ * the capsule between that position and the current one
+ * (engine::sweptCircleOverlaps()), then the position is recorded for the
+ * next test, so fast projectiles cannot tunnel through a target between
+ * two runs, whatever the tick rate or the system's decimation. A
+ * destroyOnHit hitbox only hits the hurtbox it enters first along the
+ * capsule, as it would have died there; piercing hitboxes and lasers hit
+ * every hurtbox they overlap.
  */
 class CollisionSystem : public engine::ISystem
 {
 public:
-    explicit CollisionSystem(const config::GameConfig &config)
-        : ISystem(config) {}
-    void update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) override;
+    /// Cells per world axis never exceed this, whatever the collider radii
+    static constexpr float kMaxCellsPerAxis = 64.0f;
+    /// Below this many hurtboxes a bucket has no grid and is scanned whole
+    static constexpr std::size_t kGridMinHurtboxes = 32;
+
+    explicit CollisionSystem(const config::GameConfig &config);
+    void update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemAccess access() const override;
 
 private:
-    inline bool circleVsCircle(const Transform& a, float ra, const Transform& b, float rb);
-    inline bool beamVsCircle(const Transform &projectileTransform, float beamLength, float beamHalfHeight, Transform &monsterTransform, float monsterRadius);
+    /// Hurtboxes of one layer in SoA form, in group iteration order
+    struct HurtboxColumns
+    {
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> radius;
+        std::vector<EntityId> ids;
+        std::vector<Hurtbox *> hurtboxes;
+        engine::UniformGrid grid;
+        bool gridded{false};  ///< grid was built this tick; otherwise scan the columns
+
+        std::size_t size() const { return ids.size(); }
+        void clear();
+    };
+
+    void gatherHurtboxes(engine::Registry &registry);
+
     // std::unordered_set<EntityId> &_destroySet;
+
+    engine::Bounds _world;
+    config::CollisionMatrix _layers;
+    std::array<HurtboxColumns, kCollisionLayerCount> _hurtboxes;
+    std::uint32_t _populated{0};  ///< layerBit() of every non-empty bucket this tick
+    std::vector<std::uint32_t> _hits;
 };
 }
\ No newline at end of file
@@ -13,6 +13,7 @@ class FireCooldownSystem : public engine::ISystem
 public:
     explicit FireCooldownSystem(const config::GameConfig &config)
         : ISystem(config) {}
-    void update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) override;
+    void update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemAccess access() const override;
 };
 }
\ No newline at end of file
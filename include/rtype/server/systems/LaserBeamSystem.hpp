@@ -23,9 +23,10 @@ class LaserBeamSystem : public engine::ISystem
 public:
     explicit LaserBeamSystem(const config::GameConfig &config)
         : ISystem(config) {}
-    void update(float, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) override;
+    void update(float, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemAccess access() const override;
 
 private:
-    void stopLaser(engine::Registry &registry, WeaponComponent &weapon, std::unordered_set<rtype::EntityId> &toDestroySet);
+    void stopLaser(engine::Registry &registry, WeaponComponent &weapon, engine::DestroyQueue &toDestroySet);
 };
 }
\ No newline at end of file
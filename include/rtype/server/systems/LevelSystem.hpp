@@ -20,7 +20,7 @@ class MonsterSpawnerSystem : public engine::ISystem
 public:
     MonsterSpawnerSystem(const config::GameConfig &config);
     
-    void update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) override;
+    void update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
     
     // Control spawning
     void startSpawning(int monstersToSpawn);
@@ -45,7 +45,8 @@ public:
     LevelSystem(
                 const config::GameConfig &config);
     
-    void update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) override;
+    void update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemRate rate() const override;
     
     // Query methods
     // int getCurrentWave() const { return _currentLevel; }
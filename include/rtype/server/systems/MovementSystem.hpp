@@ -10,18 +10,28 @@
 
 #include "rtype/engine/ISystem.hpp"
 
+#include <vector>
+
 namespace rtype::server
 {
 
 /**
  * @brief Movement System - Updates positions based on velocities
+ *
+ * Owns the Transform/Velocity group, which keeps both arrays packed in the
+ * same entity order, and advances them with engine::integrate() in chunks
+ * run on the registry's job system.
  */
 class MovementSystem : public engine::ISystem
 {
 public:
     explicit MovementSystem(const config::GameConfig &config)
         : ISystem(config) {}
-    void update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) override;
+    void update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemAccess access() const override;
+
+private:
+    std::vector<std::vector<EntityId>> _moved;  ///< Per-chunk entities with a non-zero velocity
 };
 
 }
@@ -15,7 +15,8 @@ class PlayerInputSystem : public engine::ISystem {
     public:
         explicit PlayerInputSystem(const config::GameConfig &config)
         : ISystem(config) {}
-        void update(float dt, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy);
+        void update(float dt, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy);
+        engine::SystemAccess access() const;
     private:
 };
 }
\ No newline at end of file
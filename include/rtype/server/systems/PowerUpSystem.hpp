@@ -11,7 +11,7 @@ class PowerUpSystem : public engine::ISystem {
     public:
         explicit PowerUpSystem(const config::GameConfig &config)
         : ISystem(config) {}
-        void update(float dt, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy);
+        void update(float dt, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy);
     private:
         float _powerUpSpawnTimer{0.0f};
         std::mt19937 _rng{std::random_device{}()};
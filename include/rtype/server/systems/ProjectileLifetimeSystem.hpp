@@ -19,7 +19,8 @@ class ProjectileLifetimeSystem : public engine::ISystem
 {
 public:
     ProjectileLifetimeSystem(const config::GameConfig &config);
-    void update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) override;
+    void update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemAccess access() const override;
 
 private:
     float _maxLifetime;
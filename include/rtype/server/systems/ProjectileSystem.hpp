@@ -0,0 +1,44 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** ProjectileSystem
+*/
+
+#pragma once
+
+#include "rtype/engine/ISystem.hpp"
+
+namespace rtype::server
+{
+
+/**
+ * @brief Projectile System - Ages and bound-checks projectiles in one pass
+ *
+ * Fused replacement for what ProjectileLifetimeSystem and BoundarySystem do
+ * to projectiles. It walks an owning Projectile group, so each bullet is
+ * loaded once per tick instead of once per system; movement stays in
+ * MovementSystem's vectorized pass. Enabled with [Systems] FusedProjectiles;
+ * BoundarySystem then skips projectiles and ProjectileLifetimeSystem is not
+ * loaded. Each step only runs if the system it replaces is enabled.
+ *
+ * Off by default: reaching each bullet's Transform through the group's
+ * sparse lookup costs more than the split systems' packed passes save,
+ * and movement cannot join the loop without taking projectiles out of
+ * MovementSystem's group. Compare both with rtype_projectile_bench.
+ */
+class ProjectileSystem : public engine::ISystem
+{
+public:
+    explicit ProjectileSystem(const config::GameConfig &config);
+    void update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemAccess access() const override;
+
+private:
+    bool _age;
+    bool _cull;
+    float _maxLifetime;
+    float _minX, _maxX, _minY, _maxY;
+};
+
+}
@@ -14,7 +14,8 @@ class ShieldFollowSystem : public engine::ISystem
 {
 public:
     ShieldFollowSystem(const config::GameConfig &config);
-    void update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy) override;
+    void update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemAccess access() const override;
 
 private:
 };
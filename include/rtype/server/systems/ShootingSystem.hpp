@@ -18,14 +18,14 @@ class ShootingSystem : public engine::ISystem {
     public:
         explicit ShootingSystem(const config::GameConfig &config)
         : ISystem(config) {}
-        void update(float dt, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy);
+        void update(float dt, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy);
 
     protected:
     private:
-        void handleLaserFireInput(EntityId entity, WeaponComponent &weapon, PlayerComponent &player, FireCooldown &cooldown, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroySet);
+        void handleLaserFireInput(EntityId entity, WeaponComponent &weapon, PlayerComponent &player, FireCooldown &cooldown, engine::Registry &registry, engine::DestroyQueue &toDestroySet);
         void shootProjectile(WeaponComponent &weapon, const EntityId entity, engine::Registry &registry);
         void startLaserBeam(EntityId entity, WeaponComponent &weapon, PlayerComponent &playerComp, FireCooldown &cooldown, engine::Registry &registry);
-        void stopActiveLaser(WeaponComponent &weapon, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroySet);
+        void stopActiveLaser(WeaponComponent &weapon, engine::Registry &registry, engine::DestroyQueue &toDestroySet);
         void cycleEquippedWeapon(WeaponComponent &weapon);
         std::uint8_t computeLaserDamage(std::uint8_t weaponLevel) const;
         std::uint8_t computeRocketDamage(std::uint8_t weaponLevel) const;
@@ -0,0 +1,39 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** SpatialIndexSystem
+*/
+
+#pragma once
+
+#include "rtype/engine/ISystem.hpp"
+#include "rtype/engine/SpatialIndex.hpp"
+
+namespace rtype::server
+{
+
+/**
+ * @brief Spatial Index System - Rebuilds the registry's SpatialIndex every tick
+ *
+ * Players with a Transform and a Collider go in, as circles of the
+ * collider's radius, so PowerUpSystem asks the index which players touch a
+ * power-up instead of scanning them. Bullets and monsters stay out: no
+ * reader needs them, and CollisionSystem keeps its own per-layer grids.
+ * A new reader widens the view. Runs once movement and culling are done;
+ * does nothing while the registry has no index installed, or while the
+ * [CollisionLayers] matrix keeps players from collecting power-ups.
+ */
+class SpatialIndexSystem : public engine::ISystem
+{
+public:
+    explicit SpatialIndexSystem(const config::GameConfig &config);
+    void update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy) override;
+    engine::SystemAccess access() const override;
+
+private:
+    engine::Bounds _world;
+    bool _pickups;  ///< [CollisionLayers] Player hits PowerUp
+};
+
+}
@@ -16,7 +16,8 @@ class WeaponDamageSystem : public engine::ISystem {
     public:
         explicit WeaponDamageSystem(const config::GameConfig &config)
         : ISystem(config) {}
-        void update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy);
+        void update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy);
+        engine::SystemAccess access() const;
         void dealDamage(std::uint8_t damage, Health &health);
     protected:
     private:
@@ -0,0 +1,200 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** CollisionBench - CollisionSystem on a fixed population, once per SIMD level
+*/
+
+#include "rtype/common/Components.hpp"
+#include "rtype/common/GameConfig.hpp"
+#include "rtype/engine/CpuFeatures.hpp"
+#include "rtype/engine/DestroyQueue.hpp"
+#include "rtype/engine/Registry.hpp"
+#include "rtype/engine/SimdKernels.hpp"
+#include "rtype/server/systems/CollisionSystem.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+using namespace rtype;
+
+namespace
+{
+
+constexpr std::size_t kDefaultHurtboxes = 5000;
+constexpr std::size_t kDefaultHitboxes = 5000;
+constexpr std::size_t kDefaultTicks = 300;
+constexpr std::size_t kDefaultLasers = 0;
+/// The low tick rate swept projectiles exist for
+constexpr float kStep = 1.0f / 30.0f;
+
+struct BenchResult
+{
+    double nsPerTick{0.0};
+    std::size_t hits{0};
+    std::uint64_t checksum{0};
+};
+
+/**
+ * @brief Hurtboxes of the three body layers, then bullets of both sides and lasers
+ *
+ * Bullets are built like EntityFactory::spawnBullet() builds them, with a
+ * PreviousTransform, so CollisionSystem sweeps them; the seed is fixed so
+ * every run sees the same population.
+ */
+void populate(engine::Registry &registry, const config::GameConfig &config, std::size_t hurtboxes, std::size_t hitboxes, std::size_t lasers)
+{
+    constexpr CollisionLayer kBodyLayers[] = {CollisionLayer::Monster, CollisionLayer::Neutral, CollisionLayer::Player};
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> x(0.0f, config.gameplay.worldWidth);
+    std::uniform_real_distribution<float> y(0.0f, config.gameplay.worldHeight);
+    std::uniform_real_distribution<float> radius(8.0f, 32.0f);
+    std::uniform_real_distribution<float> speed(300.0f, 900.0f);
+
+    for (std::size_t i = 0; i < hurtboxes; ++i)
+    {
+        const EntityId id = registry.createEntity();
+        registry.addComponent<Transform>(id, x(rng), y(rng));
+        registry.addComponent<Velocity>(id, 0.0f, 0.0f);
+        registry.addComponent<Collider>(id, radius(rng));
+        registry.addComponent<Hurtbox>(id, std::nullopt, kBodyLayers[i % 3]);
+    }
+
+    for (std::size_t i = 0; i < hitboxes; ++i)
+    {
+        const bool fromPlayer = i % 2 == 0;
+        const Transform at{x(rng), y(rng)};
+        const EntityId id = registry.createEntity();
+        registry.addComponent<Transform>(id, at);
+        registry.addComponent<Velocity>(id, fromPlayer ? speed(rng) : -speed(rng), 0.0f);
+        registry.addComponent<Collider>(id, config.gameRender.bulletSize);
+        registry.addComponent<Hitbox>(id, true, fromPlayer ? CollisionLayer::PlayerBullet : CollisionLayer::MonsterBullet);
+        registry.addComponent<PreviousTransform>(id, at.x, at.y);
+    }
+
+    for (std::size_t i = 0; i < lasers; ++i)
+    {
+        const EntityId id = registry.createEntity();
+        registry.addComponent<Transform>(id, 0.0f, y(rng));
+        registry.addComponent<Velocity>(id, 0.0f, 0.0f);
+        registry.addComponent<BeamCollider>(id, config.gameplay.worldWidth, config.gameRender.bulletSize * 1.5f);
+        registry.addComponent<Hitbox>(id, false, CollisionLayer::PlayerBullet);
+    }
+}
+
+/**
+ * @brief Move bullets one tick, wrapping them around the world without a sweep
+ */
+void advance(engine::Registry &registry, const config::GameConfig &config)
+{
+    const float width = config.gameplay.worldWidth;
+    registry.view<Transform, Velocity, PreviousTransform>([&](EntityId, Transform &transform, Velocity &velocity, PreviousTransform &previous) {
+        transform.x += velocity.vx * kStep;
+        if (transform.x < 0.0f || transform.x > width)
+        {
+            transform.x -= transform.x < 0.0f ? -width : width;
+            previous = PreviousTransform{transform.x, transform.y};
+        }
+    });
+}
+
+/**
+ * @brief Fold this tick's contacts into the result, then reset them
+ */
+void collect(engine::Registry &registry, BenchResult &result)
+{
+    registry.view<Hurtbox>([&](EntityId id, Hurtbox &hurtbox) {
+        if (!hurtbox.collidedWith)
+            return;
+        ++result.hits;
+        result.checksum = (result.checksum ^ ((static_cast<std::uint64_t>(id) << 32) | *hurtbox.collidedWith)) * 1099511628211ull;
+        hurtbox.collidedWith.reset();
+    });
+}
+
+BenchResult run(const config::GameConfig &config, std::size_t hurtboxes, std::size_t hitboxes, std::size_t lasers, std::size_t ticks)
+{
+    engine::Registry registry;
+    populate(registry, config, hurtboxes, hitboxes, lasers);
+
+    server::CollisionSystem collisions(config);
+    engine::DestroyQueue toDestroy;
+    int level = 0;
+    BenchResult result;
+    std::chrono::steady_clock::duration elapsed{};
+
+    for (std::size_t tick = 0; tick < ticks; ++tick)
+    {
+        advance(registry, config);
+
+        const auto start = std::chrono::steady_clock::now();
+        collisions.update(kStep, level, registry, toDestroy);
+        elapsed += std::chrono::steady_clock::now() - start;
+
+        // Destroyed bullets stay in play so every tick tests the same population
+        collect(registry, result);
+        toDestroy.clear();
+    }
+
+    result.nsPerTick = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / static_cast<double>(ticks);
+    return result;
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t hurtboxes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultHurtboxes;
+    const std::size_t hitboxes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : kDefaultHitboxes;
+    const std::size_t ticks = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : kDefaultTicks;
+    const std::size_t lasers = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : kDefaultLasers;
+
+    if (ticks == 0)
+    {
+        std::cerr << "usage: " << argv[0] << " [hurtboxes] [hitboxes] [ticks] [lasers]\n";
+        return 1;
+    }
+
+    const config::GameConfig config = config::GameConfig::getDefault();
+    const engine::SimdLevel detected = engine::detectSimdLevel();
+
+    std::cout << "[bench] " << hurtboxes << " hurtboxes, " << hitboxes << " hitboxes, " << lasers << " lasers, "
+              << ticks << " ticks, detected " << engine::simdLevelName(detected) << "\n";
+
+    // Every variant must report the same contacts: the checksums are compared
+    constexpr engine::SimdLevel kLevels[] = {engine::SimdLevel::Scalar, engine::SimdLevel::Sse42, engine::SimdLevel::Avx2, engine::SimdLevel::Avx512};
+    bool first = true;
+    BenchResult reference;
+    bool mismatch = false;
+
+    for (engine::SimdLevel level : kLevels)
+    {
+        if (engine::selectSimdKernels(level) != level)
+            continue;
+
+        run(config, hurtboxes, hitboxes, lasers, 1);
+        const BenchResult result = run(config, hurtboxes, hitboxes, lasers, ticks);
+        std::cout << "[bench] " << std::left << std::setw(8) << engine::simdLevelName(level) << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(12) << result.nsPerTick / 1000.0 << " us/tick"
+                  << "  hits " << result.hits << "  checksum " << std::hex << result.checksum << std::dec << "\n";
+
+        if (first)
+            reference = result;
+        else if (result.hits != reference.hits || result.checksum != reference.checksum)
+            mismatch = true;
+        first = false;
+    }
+
+    engine::selectSimdKernels(detected);
+    if (mismatch)
+    {
+        std::cerr << "[bench] SIMD variants disagree on the contacts\n";
+        return 1;
+    }
+    return 0;
+}
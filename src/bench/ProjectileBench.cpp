@@ -0,0 +1,169 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** ProjectileBench - Fused ProjectileSystem against ProjectileLifetime + Boundary
+*/
+
+#include "rtype/common/Components.hpp"
+#include "rtype/common/GameConfig.hpp"
+#include "rtype/engine/DestroyQueue.hpp"
+#include "rtype/engine/JobSystem.hpp"
+#include "rtype/engine/Registry.hpp"
+#include "rtype/server/systems/BoundarySystem.hpp"
+#include "rtype/server/systems/MovementSystem.hpp"
+#include "rtype/server/systems/ProjectileLifetimeSystem.hpp"
+#include "rtype/server/systems/ProjectileSystem.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace rtype;
+
+namespace
+{
+
+constexpr std::size_t kDefaultProjectiles = 20000;
+constexpr std::size_t kDefaultTicks = 600;
+constexpr float kStep = 1.0f / 60.0f;
+
+struct BenchResult
+{
+    double nsPerTick{0.0};
+    std::size_t culled{0};
+};
+
+/**
+ * @brief Registry shaped like a busy room: bullets plus a few moving monsters
+ *
+ * CollisionSystem's Hitbox group is created up front so storages are laid
+ * out as they are in the server.
+ */
+void populate(engine::Registry &registry, const config::GameConfig &config, std::size_t projectiles)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> x(0.0f, config.gameplay.worldWidth);
+    std::uniform_real_distribution<float> y(0.0f, config.gameplay.worldHeight);
+    std::uniform_real_distribution<float> speed(-600.0f, 600.0f);
+
+    registry.trackChanges<Transform>();
+    registry.group<Hitbox>(engine::observe<Transform>);
+
+    for (std::size_t i = 0; i < projectiles; ++i)
+    {
+        const EntityId id = registry.createEntity();
+        registry.addComponent<Transform>(id, x(rng), y(rng));
+        registry.addComponent<Velocity>(id, speed(rng), speed(rng) * 0.1f);
+        Projectile projectile{};
+        projectile.lifetime = static_cast<float>(i % 60) * kStep;
+        registry.addComponent<Projectile>(id, projectile);
+        registry.addComponent<Hitbox>(id, true);
+    }
+
+    for (std::size_t i = 0; i < projectiles / 20; ++i)
+    {
+        const EntityId id = registry.createEntity();
+        registry.addComponent<Transform>(id, x(rng), y(rng));
+        registry.addComponent<Velocity>(id, -100.0f, 0.0f);
+        registry.addComponent<Hitbox>(id, true);
+    }
+}
+
+/**
+ * @brief Put culled entities back in play so every tick walks the same population
+ */
+void recycle(engine::Registry &registry, engine::DestroyQueue &toDestroy, const config::GameConfig &config)
+{
+    for (EntityId id : toDestroy)
+    {
+        if (auto *transform = registry.getComponent<Transform>(id))
+            *transform = Transform{config.gameplay.worldWidth * 0.5f, config.gameplay.worldHeight * 0.5f};
+        if (auto *projectile = registry.getComponent<Projectile>(id))
+            projectile->lifetime = 0.0f;
+    }
+    toDestroy.clear();
+    registry.clearChanged();
+}
+
+BenchResult run(bool fused, const config::GameConfig &baseConfig, std::size_t projectiles, std::size_t ticks, engine::JobSystem *jobs)
+{
+    config::GameConfig config = baseConfig;
+    config.systems.fusedProjectiles = fused;
+
+    engine::Registry registry;
+    registry.setJobSystem(jobs);
+    populate(registry, config, projectiles);
+
+    std::vector<std::unique_ptr<engine::ISystem>> systems;
+    systems.push_back(std::make_unique<server::MovementSystem>(config));
+    if (fused)
+        systems.push_back(std::make_unique<server::ProjectileSystem>(config));
+    else
+        systems.push_back(std::make_unique<server::ProjectileLifetimeSystem>(config));
+    systems.push_back(std::make_unique<server::BoundarySystem>(config));
+
+    engine::DestroyQueue toDestroy;
+    int level = 0;
+    BenchResult result;
+    std::chrono::steady_clock::duration elapsed{};
+
+    for (std::size_t tick = 0; tick < ticks; ++tick)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (auto &system : systems)
+            system->update(kStep, level, registry, toDestroy);
+        elapsed += std::chrono::steady_clock::now() - start;
+
+        result.culled += toDestroy.size();
+        recycle(registry, toDestroy, config);
+    }
+
+    result.nsPerTick = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / static_cast<double>(ticks);
+    return result;
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t projectiles = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultProjectiles;
+    const std::size_t ticks = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : kDefaultTicks;
+    const std::size_t workers = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 0;
+
+    if (projectiles == 0 || ticks == 0)
+    {
+        std::cerr << "usage: " << argv[0] << " [projectiles] [ticks] [workers]\n";
+        return 1;
+    }
+
+    const config::GameConfig config = config::GameConfig::getDefault();
+    std::unique_ptr<engine::JobSystem> jobs;
+    if (workers > 0)
+        jobs = std::make_unique<engine::JobSystem>(workers);
+
+    std::cout << "[bench] " << projectiles << " projectiles, " << ticks << " ticks, "
+              << workers << " workers\n";
+
+    // Warm both paths once so page faults and lazy groups are not measured
+    run(false, config, projectiles, 1, jobs.get());
+    run(true, config, projectiles, 1, jobs.get());
+
+    const BenchResult split = run(false, config, projectiles, ticks, jobs.get());
+    const BenchResult fused = run(true, config, projectiles, ticks, jobs.get());
+
+    const auto report = [&](const char *name, const BenchResult &result) {
+        std::cout << "[bench] " << std::left << std::setw(8) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(12) << result.nsPerTick / 1000.0 << " us/tick"
+                  << std::setw(10) << result.nsPerTick / static_cast<double>(projectiles) << " ns/projectile"
+                  << "  (culled " << result.culled << ")\n";
+    };
+    report("split", split);
+    report("fused", fused);
+    std::cout << "[bench] speedup " << std::setprecision(2) << split.nsPerTick / fused.nsPerTick << "x\n";
+    return 0;
+}
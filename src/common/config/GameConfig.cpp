@@ -2,6 +2,8 @@
 
 #include <fstream>
 #include <sstream>
+#include <string_view>
+#include <utility>
 #include <iostream>
 #include <algorithm>
 #include <cmath>
@@ -59,6 +61,49 @@ Team parseTeam(const std::string& value)
     return Team::Monster;
 }
 
+bool parseCollisionLayer(const std::string& value, CollisionLayer& layer)
+{
+    std::string lower = value;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+
+    static constexpr std::pair<std::string_view, CollisionLayer> names[] = {
+        {"player", CollisionLayer::Player},
+        {"playerbullet", CollisionLayer::PlayerBullet},
+        {"monster", CollisionLayer::Monster},
+        {"monsterbullet", CollisionLayer::MonsterBullet},
+        {"neutral", CollisionLayer::Neutral},
+        {"neutralbullet", CollisionLayer::NeutralBullet},
+        {"powerup", CollisionLayer::PowerUp},
+        {"monstershield", CollisionLayer::MonsterShield},
+        {"neutralshield", CollisionLayer::NeutralShield},
+    };
+    for (const auto &[name, candidate] : names)
+    {
+        if (lower == name)
+        {
+            layer = candidate;
+            return true;
+        }
+    }
+    std::cerr << "[config] Unknown collision layer: " << value << '\n';
+    return false;
+}
+
+// "Monster, MonsterShield" -> layerBit(Monster) | layerBit(MonsterShield); empty hits nothing
+std::uint32_t parseLayerMask(const std::string& value)
+{
+    std::uint32_t mask = 0;
+    std::istringstream ss(value);
+    std::string name;
+    CollisionLayer layer{};
+    while (std::getline(ss, name, ','))
+    {
+        name = trim(name);
+        if (!name.empty() && parseCollisionLayer(name, layer))
+            mask |= layerBit(layer);
+    }
+    return mask;
+}
 
 ScrollDirection parseScrollDirection(const std::string& value)
 {
@@ -289,6 +334,8 @@ bool GameConfig::loadFromFile(const std::string& path)
             else if (key == "RxBufferSize") network.rxBufferSize = std::stoul(value);
             else if (key == "ServerTimeout" && std::stof(value) >= 1.0f) network.serverTimeout = std::stof(value);
             else if (key == "ClientTimeout" && std::stof(value) >= 1.0f) network.clientTimeout = std::stof(value);
+            else if (key == "StatsDumpInterval") network.statsDumpInterval = std::max(0.0f, std::stof(value));
+            else if (key == "ProfileCsvPath") network.profileCsvPath = value;
         }
         else if (currentSection == "Audio")
         {
@@ -305,6 +352,7 @@ bool GameConfig::loadFromFile(const std::string& path)
             if (key == "MovementSystem") systems.movementSystem = parseBool(value);
             else if (key == "FireCooldownSystem") systems.fireCooldownSystem = parseBool(value);
             else if (key == "ProjectileLifetimeSystem") systems.projectileLifetimeSystem = parseBool(value);
+            else if (key == "FusedProjectiles") systems.fusedProjectiles = parseBool(value);
             else if (key == "CollisionSystem") systems.collisionSystem = parseBool(value);
             else if (key == "BoundarySystem") systems.boundarySystem = parseBool(value);
             else if (key == "CleanupSystem") systems.cleanupSystem = parseBool(value);
@@ -314,6 +362,29 @@ bool GameConfig::loadFromFile(const std::string& path)
         else if (currentSection == "SystemParameters")
         {
             if (key == "BoundaryMargin") systems.boundaryMargin = std::stof(value);
+            else if (key == "WorkerThreads") systems.workerThreads = std::stoul(value);
+            else if (key == "ProfileSystems") systems.profileSystems = parseBool(value);
+            else if (key == "FixedTimestep") systems.fixedTimestep = parseBool(value);
+            else if (key == "TickRate" && std::stof(value) >= 1.0f) systems.tickRate = std::stof(value);
+            else if (key == "StaticPipeline") systems.staticPipeline = parseBool(value);
+            else if (key == "SimdKernels") systems.simdKernels = value;
+            else if (key == "MaxSubsteps" && std::stoul(value) >= 1) systems.maxSubsteps = std::stoul(value);
+        }
+        else if (currentSection == "SystemRates")
+        {
+            // <System>=<divisor> and optionally <System>Phase=<tick offset>
+            constexpr std::string_view phaseSuffix = "Phase";
+            if (key.size() > phaseSuffix.size() && key.ends_with(phaseSuffix))
+                systems.rates[key.substr(0, key.size() - phaseSuffix.size())].phase = std::stol(value);
+            else
+                systems.rates[key].divisor = static_cast<std::uint32_t>(std::max(1ul, std::stoul(value)));
+        }
+        else if (currentSection == "CollisionLayers")
+        {
+            // <HitboxLayer>=<hurtbox layers it hits>, replacing that row of the defaults
+            CollisionLayer layer{};
+            if (parseCollisionLayer(key, layer))
+                systems.collisionLayers.hits[static_cast<std::size_t>(layer)] = parseLayerMask(value);
         }
         else if (currentSection == "Assets")
         {
@@ -591,6 +662,8 @@ bool GameConfig::saveToFile(const std::string& path) const
     file << "RxBufferSize=" << network.rxBufferSize << '\n';
     file << "ServerTimeout=" << network.serverTimeout << '\n';
     file << "ClientTimeout=" << network.clientTimeout << '\n';
+    file << "StatsDumpInterval=" << network.statsDumpInterval << '\n';
+    file << "ProfileCsvPath=" << network.profileCsvPath << '\n';
     file << '\n';
     
     file << "[Audio]\n";
@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** CpuFeatures
+*/
+
+#include "rtype/engine/CpuFeatures.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace rtype::engine {
+
+namespace {
+
+SimdLevel queryCpu()
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return SimdLevel::Avx512;
+    if (__builtin_cpu_supports("avx2"))
+        return SimdLevel::Avx2;
+    if (__builtin_cpu_supports("sse4.2"))
+        return SimdLevel::Sse42;
+    return SimdLevel::Scalar;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int leaf1[4] = {};
+    int leaf7[4] = {};
+    __cpuid(leaf1, 1);
+    __cpuidex(leaf7, 7, 0);
+
+    const bool sse42 = (leaf1[2] >> 20) & 1;
+    const bool osxsave = (leaf1[2] >> 27) & 1;
+    const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    const bool ymmSaved = (xcr0 & 0x6) == 0x6;
+    const bool zmmSaved = (xcr0 & 0xe6) == 0xe6;
+
+    if (ymmSaved && zmmSaved && ((leaf7[1] >> 16) & 1))
+        return SimdLevel::Avx512;
+    if (ymmSaved && ((leaf7[1] >> 5) & 1))
+        return SimdLevel::Avx2;
+    return sse42 ? SimdLevel::Sse42 : SimdLevel::Scalar;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+}
+
+SimdLevel detectSimdLevel()
+{
+    static const SimdLevel level = queryCpu();
+    return level;
+}
+
+const char *simdLevelName(SimdLevel level)
+{
+    switch (level)
+    {
+    case SimdLevel::Sse42:
+        return "sse4.2";
+    case SimdLevel::Avx2:
+        return "avx2";
+    case SimdLevel::Avx512:
+        return "avx512";
+    case SimdLevel::Scalar:
+        break;
+    }
+    return "scalar";
+}
+
+std::optional<SimdLevel> parseSimdLevel(std::string_view name)
+{
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Sse42, SimdLevel::Avx2, SimdLevel::Avx512})
+    {
+        if (name == simdLevelName(level))
+            return level;
+    }
+    return std::nullopt;
+}
+
+}
@@ -0,0 +1,43 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** FixedTimestep
+*/
+
+#include "rtype/engine/FixedTimestep.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rtype::engine {
+
+FixedTimestep::FixedTimestep(float tickRate, std::size_t maxSubsteps)
+    : _step(1.0f / std::max(tickRate, 1.0f)), _maxSubsteps(std::max<std::size_t>(maxSubsteps, 1))
+{
+}
+
+std::size_t FixedTimestep::advance(float frameSeconds)
+{
+    _accumulator += std::max(frameSeconds, 0.0f);
+
+    std::size_t steps = 0;
+    while (_accumulator >= _step && steps < _maxSubsteps)
+    {
+        _accumulator -= _step;
+        ++steps;
+    }
+
+    // Too far behind: forget the backlog but keep the phase of the next tick
+    if (_accumulator >= _step)
+    {
+        const float owed = std::floor(_accumulator / _step);
+        _dropped += static_cast<std::uint64_t>(owed);
+        _accumulator -= owed * _step;
+    }
+
+    _tick += steps;
+    return steps;
+}
+
+}
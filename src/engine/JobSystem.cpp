@@ -0,0 +1,203 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** JobSystem
+*/
+
+#include "rtype/engine/JobSystem.hpp"
+
+namespace rtype::engine {
+
+namespace {
+
+/// Pool the current thread works for, and its queue index in that pool
+thread_local const JobSystem *tlsOwner = nullptr;
+thread_local std::size_t tlsQueue = 0;
+
+}
+
+// ========== Job Group ==========
+
+JobGroup::~JobGroup()
+{
+    if (_pending.load(std::memory_order_acquire) != 0)
+        _jobs.waitFor(*this);
+}
+
+void JobGroup::wait()
+{
+    _jobs.waitFor(*this);
+    _tasks.clear();
+
+    if (_error)
+    {
+        std::exception_ptr error = std::exchange(_error, nullptr);
+        std::rethrow_exception(error);
+    }
+}
+
+void JobGroup::fail(std::exception_ptr error)
+{
+    std::lock_guard<std::mutex> lock(_errorMutex);
+    if (!_error)
+        _error = std::move(error);
+}
+
+// ========== Job System ==========
+
+JobSystem::JobSystem(std::size_t workers)
+{
+    // Threads outside the pool still need a queue to hand jobs to
+    const std::size_t queues = std::max<std::size_t>(workers, 1);
+    _queues.reserve(queues);
+    for (std::size_t i = 0; i < queues; ++i)
+        _queues.push_back(std::make_unique<Queue>());
+
+    _threads.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i)
+        _threads.emplace_back([this, i]() { workerLoop(i); });
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _stopping = true;
+    }
+    _wake.notify_all();
+
+    for (auto &thread : _threads)
+        thread.join();
+}
+
+void JobSystem::invokeTask(const void *context, std::size_t)
+{
+    (*static_cast<const std::function<void()> *>(context))();
+}
+
+std::size_t JobSystem::localQueue() const
+{
+    return tlsOwner == this ? tlsQueue : _queues.size();
+}
+
+void JobSystem::submit(const Job &job)
+{
+    std::size_t target = localQueue();
+    if (target == _queues.size())
+        target = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+
+    {
+        std::lock_guard<std::mutex> lock(_queues[target]->mutex);
+        _queues[target]->jobs.push_back(job);
+    }
+    _queued.fetch_add(1, std::memory_order_release);
+
+    // Taking the lock orders the push before a sleeper re-checks _queued
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+    }
+    _wake.notify_one();
+}
+
+bool JobSystem::tryRunOne()
+{
+    if (_queued.load(std::memory_order_acquire) == 0)
+        return false;
+
+    const std::size_t local = localQueue();
+    Job job{};
+    bool found = false;
+
+    // Own queue first, newest job (LIFO)
+    if (local < _queues.size())
+    {
+        std::lock_guard<std::mutex> lock(_queues[local]->mutex);
+        auto &jobs = _queues[local]->jobs;
+        if (!jobs.empty())
+        {
+            job = jobs.back();
+            jobs.pop_back();
+            found = true;
+        }
+    }
+
+    // Then steal the oldest job of another queue (FIFO)
+    const std::size_t start = local < _queues.size() ? local + 1 : 0;
+    for (std::size_t i = 0; !found && i < _queues.size(); ++i)
+    {
+        const std::size_t victim = (start + i) % _queues.size();
+        if (victim == local)
+            continue;
+
+        std::lock_guard<std::mutex> lock(_queues[victim]->mutex);
+        auto &jobs = _queues[victim]->jobs;
+        if (!jobs.empty())
+        {
+            job = jobs.front();
+            jobs.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found)
+        return false;
+
+    _queued.fetch_sub(1, std::memory_order_relaxed);
+    execute(job);
+    return true;
+}
+
+void JobSystem::execute(const Job &job)
+{
+    try
+    {
+        job.invoke(job.context, job.index);
+    }
+    catch (...)
+    {
+        job.group->fail(std::current_exception());
+    }
+
+    if (job.group->_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        // Lock so a waiter cannot miss the wake-up between its check and wait
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _done.notify_all();
+    }
+}
+
+void JobSystem::waitFor(JobGroup &group)
+{
+    while (group._pending.load(std::memory_order_acquire) != 0)
+    {
+        if (tryRunOne())
+            continue;
+
+        // Nothing left to help with: our jobs are running on other threads
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _done.wait(lock, [this, &group]() {
+            return group._pending.load(std::memory_order_acquire) == 0
+                || _queued.load(std::memory_order_acquire) != 0;
+        });
+    }
+}
+
+void JobSystem::workerLoop(std::size_t index)
+{
+    tlsOwner = this;
+    tlsQueue = index;
+
+    while (true)
+    {
+        if (tryRunOne())
+            continue;
+
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _wake.wait(lock, [this]() { return _stopping || _queued.load(std::memory_order_acquire) != 0; });
+        if (_stopping)
+            return;
+    }
+}
+
+}
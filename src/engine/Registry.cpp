@@ -1,40 +1,225 @@
 #include "rtype/engine/Registry.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <stdexcept>
+
 namespace rtype::engine
 {
 
+// ========== Component Types ==========
+
+ComponentTypeId detail::nextComponentTypeId()
+{
+    static std::atomic<ComponentTypeId> counter{0};
+    const ComponentTypeId id = counter.fetch_add(1, std::memory_order_relaxed);
+    if (id >= kMaxComponentTypes)
+        throw std::length_error("Registry: too many component types (raise kMaxComponentTypes)");
+    return id;
+}
+
+// ========== Construction ==========
+
+Registry::Registry(std::pmr::memory_resource *resource)
+    : _resource(resource)
+    , _componentStorages(resource)
+    , _signatures(1, ComponentMask{}, resource)
+    , _commands(*this, resource)
+    , _groups(resource)
+    , _changeSets(resource)
+    , _slots(1, kNullEntity, resource)
+    , _generations(1, 0, resource)
+    , _freeSlots(resource)
+{
+}
+
 // ========== Entity Management ==========
 
 EntityId Registry::createEntity()
 {
-    EntityId id;
+    std::uint32_t index;
     
-    if (!_freeEntityIds.empty())
+    if (_freeSlotsHead < _freeSlots.size())
     {
-        id = _freeEntityIds.back();
-        _freeEntityIds.pop_back();
+        index = _freeSlots[_freeSlotsHead++];
+        
+        // Drop the consumed prefix once it dominates the queue
+        if (_freeSlotsHead > 64 && _freeSlotsHead * 2 > _freeSlots.size())
+        {
+            _freeSlots.erase(_freeSlots.begin(), _freeSlots.begin() + static_cast<std::ptrdiff_t>(_freeSlotsHead));
+            _freeSlotsHead = 0;
+        }
     }
     else
     {
-        id = _nextEntityId++;
+        if (_slots.size() > kMaxEntities)
+            throw std::length_error("Registry: too many live entities (raise kEntityIndexBits)");
+        
+        index = static_cast<std::uint32_t>(_slots.size());
+        _slots.push_back(kNullEntity);
+        _generations.push_back(0);
+        _signatures.emplace_back();
     }
     
-    _activeEntities.insert(id);
+    const EntityId id = makeEntityId(index, _generations[index]);
+    _slots[index] = id;
+    _signatures[index].reset();
+    ++_aliveCount;
     
     return id;
 }
 
 void Registry::destroyEntity(EntityId id)
 {
-    _activeEntities.erase(id);
+    if (!entityExists(id))
+        return;
+    
+    if (_commands.deferring())
+    {
+        _commands.destroy(id);
+        return;
+    }
+    
+    const std::uint32_t index = entityIndex(id);
     
-    for (auto &[typeHash, storage] : _componentStorages)
+    notifyComponentRemoved(id, _signatures[index]);
+    
+    // Only visit the storages this entity actually has a component in
+    std::uint64_t bits = _signatures[index].to_ullong();
+    while (bits != 0)
     {
-        if (storage)
-            storage->removeEntity(id);
+        const auto typeId = static_cast<ComponentTypeId>(std::countr_zero(bits));
+        bits &= bits - 1;
+        _componentStorages[typeId]->removeEntity(id);
     }
+    _signatures[index].reset();
     
-    _freeEntityIds.push_back(id);
+    // Bump the generation so every outstanding handle to this slot goes stale
+    _generations[index] = (_generations[index] + 1) & kEntityGenerationMask;
+    _slots[index] = kNullEntity;
+    _freeSlots.push_back(index);
+    --_aliveCount;
+}
+
+// ========== Deferred Commands ==========
+
+void CommandBuffer::DestroyCommand::apply(Registry &registry)
+{
+    registry.destroyEntity(id);
+}
+
+CommandBuffer::~CommandBuffer()
+{
+    release();
+    for (const Block &block : _blocks)
+        _resource->deallocate(block.data, block.size, alignof(std::max_align_t));
+}
+
+void CommandBuffer::flush()
+{
+    // Applying runs outside any iteration, so nothing is re-queued meanwhile
+    for (Command *command : _commands)
+        command->apply(_registry);
+    release();
+}
+
+void CommandBuffer::release()
+{
+    for (Command *command : _commands)
+        std::destroy_at(command);
+    _commands.clear();
+    _block = 0;
+    _offset = 0;
+}
+
+void *CommandBuffer::allocate(std::size_t size, std::size_t alignment)
+{
+    for (; _block < _blocks.size(); ++_block, _offset = 0)
+    {
+        const Block &block = _blocks[_block];
+        const std::size_t start = (_offset + alignment - 1) & ~(alignment - 1);
+        if (start + size <= block.size)
+        {
+            _offset = start + size;
+            return block.data + start;
+        }
+    }
+
+    // Every kept block is full: add one, bigger than kBlockSize for an oversized command
+    const std::size_t blockSize = std::max(kBlockSize, size);
+    auto *data = static_cast<std::byte *>(_resource->allocate(blockSize, alignof(std::max_align_t)));
+    _blocks.push_back(Block{data, blockSize});
+    _block = _blocks.size() - 1;
+    _offset = size;
+    return data;
+}
+
+// ========== Change Tracking ==========
+
+void Registry::clearChanged()
+{
+    for (auto &changes : _changeSets)
+    {
+        if (changes)
+            changes->clear();
+    }
+}
+
+// ========== Introspection ==========
+
+RegistryStats Registry::stats() const
+{
+    RegistryStats stats;
+    stats.liveEntities = _aliveCount;
+    stats.entitySlots = _slots.size() - 1;
+    stats.freeSlots = _freeSlots.size() - _freeSlotsHead;
+    stats.pendingCommands = _commands.size();
+    stats.groups = _groups.size();
+    stats.tick = _tick;
+    
+    for (const auto &changes : _changeSets)
+    {
+        if (changes)
+            stats.trackedChanges += changes->size();
+    }
+    
+    accumulateBytes(_slots, stats.bookkeepingBytesUsed, stats.bookkeepingBytesReserved);
+    accumulateBytes(_generations, stats.bookkeepingBytesUsed, stats.bookkeepingBytesReserved);
+    accumulateBytes(_signatures, stats.bookkeepingBytesUsed, stats.bookkeepingBytesReserved);
+    accumulateBytes(_freeSlots, stats.bookkeepingBytesUsed, stats.bookkeepingBytesReserved);
+    
+    for (ComponentTypeId typeId = 0; typeId < _componentStorages.size(); ++typeId)
+    {
+        if (!_componentStorages[typeId])
+            continue;
+        
+        StorageStats storage = _componentStorages[typeId]->stats();
+        storage.typeId = typeId;
+        stats.storages.push_back(storage);
+    }
+    
+    return stats;
+}
+
+// ========== Groups ==========
+
+void Registry::notifyComponentAdded(EntityId id, ComponentTypeId typeId)
+{
+    for (auto &group : _groups)
+    {
+        if (group->required().test(typeId))
+            group->onComponentAdded(id, _signatures[entityIndex(id)]);
+    }
+}
+
+void Registry::notifyComponentRemoved(EntityId id, const ComponentMask &removed)
+{
+    for (auto &group : _groups)
+    {
+        if ((group->required() & removed).any())
+            group->onComponentRemoved(id);
+    }
 }
 
 
@@ -0,0 +1,557 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** SimdKernels
+*/
+
+#include "rtype/engine/SimdKernels.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define RTYPE_ALWAYS_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define RTYPE_ALWAYS_INLINE __forceinline
+#else
+#define RTYPE_ALWAYS_INLINE inline
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define RTYPE_SIMD_X86 1
+// Each variant is compiled for its own instruction set inside this portable TU
+#define RTYPE_TARGET(isa) __attribute__((target(isa)))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define RTYPE_SIMD_X86 1
+#define RTYPE_TARGET(isa)
+#endif
+
+#if defined(RTYPE_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+namespace rtype::engine {
+
+namespace {
+
+// ========== Scalar ==========
+// Also finishes the tail of every vector variant, from index begin; forced
+// inline so each variant keeps one encoding in unoptimized builds too.
+
+RTYPE_ALWAYS_INLINE void integrateFrom(std::size_t begin, float *position, const float *velocity, std::size_t lanes, float deltaTime)
+{
+    for (std::size_t i = begin; i < lanes; ++i)
+        position[i] += velocity[i] * deltaTime;
+}
+
+RTYPE_ALWAYS_INLINE std::size_t outsideBoundsFrom(std::size_t begin, const float *points, std::size_t count, Bounds bounds,
+                              std::uint32_t *outside, std::size_t found)
+{
+    for (std::size_t i = begin; i < count; ++i)
+    {
+        const float x = points[2 * i];
+        const float y = points[2 * i + 1];
+        if (x < bounds.minX || x > bounds.maxX || y < bounds.minY || y > bounds.maxY)
+            outside[found++] = static_cast<std::uint32_t>(i);
+    }
+    return found;
+}
+
+RTYPE_ALWAYS_INLINE std::size_t circleOverlapsFrom(std::size_t begin, float x, float y, float radius, const float *xs, const float *ys,
+                               const float *radii, std::size_t count, std::uint32_t *hits, std::size_t found)
+{
+    for (std::size_t i = begin; i < count; ++i)
+    {
+        const float dx = x - xs[i];
+        const float dy = y - ys[i];
+        const float reach = radius + radii[i];
+        if (dx * dx + dy * dy < reach * reach)
+            hits[found++] = static_cast<std::uint32_t>(i);
+    }
+    return found;
+}
+
+RTYPE_ALWAYS_INLINE std::size_t sweptCircleOverlapsFrom(std::size_t begin, float x0, float y0, float x1, float y1, float radius,
+                                      const float *xs, const float *ys, const float *radii, std::size_t count,
+                                      std::uint32_t *hits, std::size_t found)
+{
+    const float sx = x1 - x0;
+    const float sy = y1 - y0;
+    const float lengthSquared = sx * sx + sy * sy;
+    for (std::size_t i = begin; i < count; ++i)
+    {
+        // Clamped the way max/min instructions do, so NaN (a still circle) lands on 0
+        const float px = xs[i] - x0;
+        const float py = ys[i] - y0;
+        float t = (px * sx + py * sy) / lengthSquared;
+        t = t > 0.0f ? t : 0.0f;
+        t = t < 1.0f ? t : 1.0f;
+        const float dx = px - t * sx;
+        const float dy = py - t * sy;
+        const float reach = radius + radii[i];
+        if (dx * dx + dy * dy < reach * reach)
+            hits[found++] = static_cast<std::uint32_t>(i);
+    }
+    return found;
+}
+
+RTYPE_ALWAYS_INLINE std::size_t beamOverlapsFrom(std::size_t begin, float x, float y, float length, float halfHeight, const float *xs,
+                               const float *ys, const float *radii, std::size_t count, std::uint32_t *hits, std::size_t found)
+{
+    const float endX = length + x;
+    for (std::size_t i = begin; i < count; ++i)
+    {
+        const bool overlapsX = xs[i] - radii[i] <= endX && xs[i] + radii[i] >= x;
+        const bool overlapsY = std::fabs(ys[i] - y) <= halfHeight + radii[i];
+        if (overlapsX && overlapsY)
+            hits[found++] = static_cast<std::uint32_t>(i);
+    }
+    return found;
+}
+
+void integrateScalar(float *position, const float *velocity, std::size_t lanes, float deltaTime)
+{
+    integrateFrom(0, position, velocity, lanes, deltaTime);
+}
+
+std::size_t outsideBoundsScalar(const float *points, std::size_t count, Bounds bounds, std::uint32_t *outside)
+{
+    return outsideBoundsFrom(0, points, count, bounds, outside, 0);
+}
+
+std::size_t circleOverlapsScalar(float x, float y, float radius, const float *xs, const float *ys, const float *radii,
+                                 std::size_t count, std::uint32_t *hits)
+{
+    return circleOverlapsFrom(0, x, y, radius, xs, ys, radii, count, hits, 0);
+}
+
+std::size_t sweptCircleOverlapsScalar(float x0, float y0, float x1, float y1, float radius, const float *xs, const float *ys,
+                                      const float *radii, std::size_t count, std::uint32_t *hits)
+{
+    return sweptCircleOverlapsFrom(0, x0, y0, x1, y1, radius, xs, ys, radii, count, hits, 0);
+}
+
+std::size_t beamOverlapsScalar(float x, float y, float length, float halfHeight, const float *xs, const float *ys, const float *radii,
+                               std::size_t count, std::uint32_t *hits)
+{
+    return beamOverlapsFrom(0, x, y, length, halfHeight, xs, ys, radii, count, hits, 0);
+}
+
+/// Append begin + index of every set bit of mask
+RTYPE_ALWAYS_INLINE std::size_t appendSetBits(std::uint32_t mask, std::size_t begin, std::uint32_t *out, std::size_t found)
+{
+    while (mask != 0)
+    {
+        out[found++] = static_cast<std::uint32_t>(begin + static_cast<std::size_t>(std::countr_zero(mask)));
+        mask &= mask - 1;
+    }
+    return found;
+}
+
+/// One bit per {x, y} pair, set when either lane of the pair is
+RTYPE_ALWAYS_INLINE std::uint32_t pairMask(std::uint32_t laneMask)
+{
+    std::uint32_t pairs = 0;
+    for (unsigned pair = 0; laneMask != 0; ++pair, laneMask >>= 2)
+        pairs |= ((laneMask & 3u) != 0 ? 1u : 0u) << pair;
+    return pairs;
+}
+
+#if defined(RTYPE_SIMD_X86)
+
+// ========== SSE4.2 (4 lanes) ==========
+
+RTYPE_TARGET("sse4.2")
+void integrateSse42(float *position, const float *velocity, std::size_t lanes, float deltaTime)
+{
+    const __m128 step = _mm_set1_ps(deltaTime);
+    std::size_t i = 0;
+    for (; i + 4 <= lanes; i += 4)
+        _mm_storeu_ps(position + i, _mm_add_ps(_mm_loadu_ps(position + i), _mm_mul_ps(_mm_loadu_ps(velocity + i), step)));
+    integrateFrom(i, position, velocity, lanes, deltaTime);
+}
+
+RTYPE_TARGET("sse4.2")
+std::size_t outsideBoundsSse42(const float *points, std::size_t count, Bounds bounds, std::uint32_t *outside)
+{
+    const __m128 low = _mm_setr_ps(bounds.minX, bounds.minY, bounds.minX, bounds.minY);
+    const __m128 high = _mm_setr_ps(bounds.maxX, bounds.maxY, bounds.maxX, bounds.maxY);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        const __m128 lanes = _mm_loadu_ps(points + 2 * i);
+        const int mask = _mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(lanes, low), _mm_cmpgt_ps(lanes, high)));
+        if (mask != 0)
+            found = appendSetBits(pairMask(static_cast<std::uint32_t>(mask)), i, outside, found);
+    }
+    return outsideBoundsFrom(i, points, count, bounds, outside, found);
+}
+
+RTYPE_TARGET("sse4.2")
+std::size_t circleOverlapsSse42(float x, float y, float radius, const float *xs, const float *ys, const float *radii,
+                                std::size_t count, std::uint32_t *hits)
+{
+    const __m128 cx = _mm_set1_ps(x);
+    const __m128 cy = _mm_set1_ps(y);
+    const __m128 cr = _mm_set1_ps(radius);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 dx = _mm_sub_ps(cx, _mm_loadu_ps(xs + i));
+        const __m128 dy = _mm_sub_ps(cy, _mm_loadu_ps(ys + i));
+        const __m128 reach = _mm_add_ps(cr, _mm_loadu_ps(radii + i));
+        const __m128 distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const int mask = _mm_movemask_ps(_mm_cmplt_ps(distance, _mm_mul_ps(reach, reach)));
+        found = appendSetBits(static_cast<std::uint32_t>(mask), i, hits, found);
+    }
+    return circleOverlapsFrom(i, x, y, radius, xs, ys, radii, count, hits, found);
+}
+
+RTYPE_TARGET("sse4.2")
+std::size_t sweptCircleOverlapsSse42(float x0, float y0, float x1, float y1, float radius, const float *xs, const float *ys,
+                                     const float *radii, std::size_t count, std::uint32_t *hits)
+{
+    const float sxScalar = x1 - x0;
+    const float syScalar = y1 - y0;
+    const __m128 ox = _mm_set1_ps(x0);
+    const __m128 oy = _mm_set1_ps(y0);
+    const __m128 sx = _mm_set1_ps(sxScalar);
+    const __m128 sy = _mm_set1_ps(syScalar);
+    const __m128 lengthSquared = _mm_set1_ps(sxScalar * sxScalar + syScalar * syScalar);
+    const __m128 cr = _mm_set1_ps(radius);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 px = _mm_sub_ps(_mm_loadu_ps(xs + i), ox);
+        const __m128 py = _mm_sub_ps(_mm_loadu_ps(ys + i), oy);
+        __m128 t = _mm_div_ps(_mm_add_ps(_mm_mul_ps(px, sx), _mm_mul_ps(py, sy)), lengthSquared);
+        t = _mm_min_ps(_mm_max_ps(t, zero), one);
+        const __m128 dx = _mm_sub_ps(px, _mm_mul_ps(t, sx));
+        const __m128 dy = _mm_sub_ps(py, _mm_mul_ps(t, sy));
+        const __m128 reach = _mm_add_ps(cr, _mm_loadu_ps(radii + i));
+        const __m128 distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const int mask = _mm_movemask_ps(_mm_cmplt_ps(distance, _mm_mul_ps(reach, reach)));
+        if (mask != 0)
+            found = appendSetBits(static_cast<std::uint32_t>(mask), i, hits, found);
+    }
+    return sweptCircleOverlapsFrom(i, x0, y0, x1, y1, radius, xs, ys, radii, count, hits, found);
+}
+
+RTYPE_TARGET("sse4.2")
+std::size_t beamOverlapsSse42(float x, float y, float length, float halfHeight, const float *xs, const float *ys, const float *radii,
+                              std::size_t count, std::uint32_t *hits)
+{
+    const __m128 startX = _mm_set1_ps(x);
+    const __m128 endX = _mm_set1_ps(length + x);
+    const __m128 cy = _mm_set1_ps(y);
+    const __m128 half = _mm_set1_ps(halfHeight);
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 px = _mm_loadu_ps(xs + i);
+        const __m128 r = _mm_loadu_ps(radii + i);
+        const __m128 dy = _mm_andnot_ps(sign, _mm_sub_ps(_mm_loadu_ps(ys + i), cy));
+        const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmple_ps(_mm_sub_ps(px, r), endX), _mm_cmpge_ps(_mm_add_ps(px, r), startX)),
+                                         _mm_cmple_ps(dy, _mm_add_ps(half, r)));
+        const int mask = _mm_movemask_ps(inside);
+        if (mask != 0)
+            found = appendSetBits(static_cast<std::uint32_t>(mask), i, hits, found);
+    }
+    return beamOverlapsFrom(i, x, y, length, halfHeight, xs, ys, radii, count, hits, found);
+}
+
+// ========== AVX2 (8 lanes) ==========
+// Wide variants clear the upper halves before their scalar tail: compilers
+// only add vzeroupper themselves when optimizing, and legacy-SSE code run
+// with dirty upper registers stalls on every instruction.
+
+RTYPE_TARGET("avx2")
+void integrateAvx2(float *position, const float *velocity, std::size_t lanes, float deltaTime)
+{
+    const __m256 step = _mm256_set1_ps(deltaTime);
+    std::size_t i = 0;
+    for (; i + 8 <= lanes; i += 8)
+        _mm256_storeu_ps(position + i, _mm256_add_ps(_mm256_loadu_ps(position + i), _mm256_mul_ps(_mm256_loadu_ps(velocity + i), step)));
+    _mm256_zeroupper();
+    integrateFrom(i, position, velocity, lanes, deltaTime);
+}
+
+RTYPE_TARGET("avx2")
+std::size_t outsideBoundsAvx2(const float *points, std::size_t count, Bounds bounds, std::uint32_t *outside)
+{
+    const __m256 low = _mm256_setr_ps(bounds.minX, bounds.minY, bounds.minX, bounds.minY, bounds.minX, bounds.minY, bounds.minX, bounds.minY);
+    const __m256 high = _mm256_setr_ps(bounds.maxX, bounds.maxY, bounds.maxX, bounds.maxY, bounds.maxX, bounds.maxY, bounds.maxX, bounds.maxY);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256 lanes = _mm256_loadu_ps(points + 2 * i);
+        const __m256 out = _mm256_or_ps(_mm256_cmp_ps(lanes, low, _CMP_LT_OQ), _mm256_cmp_ps(lanes, high, _CMP_GT_OQ));
+        const int mask = _mm256_movemask_ps(out);
+        if (mask != 0)
+            found = appendSetBits(pairMask(static_cast<std::uint32_t>(mask)), i, outside, found);
+    }
+    _mm256_zeroupper();
+    return outsideBoundsFrom(i, points, count, bounds, outside, found);
+}
+
+RTYPE_TARGET("avx2")
+std::size_t circleOverlapsAvx2(float x, float y, float radius, const float *xs, const float *ys, const float *radii,
+                               std::size_t count, std::uint32_t *hits)
+{
+    const __m256 cx = _mm256_set1_ps(x);
+    const __m256 cy = _mm256_set1_ps(y);
+    const __m256 cr = _mm256_set1_ps(radius);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 dx = _mm256_sub_ps(cx, _mm256_loadu_ps(xs + i));
+        const __m256 dy = _mm256_sub_ps(cy, _mm256_loadu_ps(ys + i));
+        const __m256 reach = _mm256_add_ps(cr, _mm256_loadu_ps(radii + i));
+        const __m256 distance = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        const int mask = _mm256_movemask_ps(_mm256_cmp_ps(distance, _mm256_mul_ps(reach, reach), _CMP_LT_OQ));
+        found = appendSetBits(static_cast<std::uint32_t>(mask), i, hits, found);
+    }
+    _mm256_zeroupper();
+    return circleOverlapsFrom(i, x, y, radius, xs, ys, radii, count, hits, found);
+}
+
+RTYPE_TARGET("avx2")
+std::size_t sweptCircleOverlapsAvx2(float x0, float y0, float x1, float y1, float radius, const float *xs, const float *ys,
+                                    const float *radii, std::size_t count, std::uint32_t *hits)
+{
+    const float sxScalar = x1 - x0;
+    const float syScalar = y1 - y0;
+    const __m256 ox = _mm256_set1_ps(x0);
+    const __m256 oy = _mm256_set1_ps(y0);
+    const __m256 sx = _mm256_set1_ps(sxScalar);
+    const __m256 sy = _mm256_set1_ps(syScalar);
+    const __m256 lengthSquared = _mm256_set1_ps(sxScalar * sxScalar + syScalar * syScalar);
+    const __m256 cr = _mm256_set1_ps(radius);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 px = _mm256_sub_ps(_mm256_loadu_ps(xs + i), ox);
+        const __m256 py = _mm256_sub_ps(_mm256_loadu_ps(ys + i), oy);
+        __m256 t = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(px, sx), _mm256_mul_ps(py, sy)), lengthSquared);
+        t = _mm256_min_ps(_mm256_max_ps(t, zero), one);
+        const __m256 dx = _mm256_sub_ps(px, _mm256_mul_ps(t, sx));
+        const __m256 dy = _mm256_sub_ps(py, _mm256_mul_ps(t, sy));
+        const __m256 reach = _mm256_add_ps(cr, _mm256_loadu_ps(radii + i));
+        const __m256 distance = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        const int mask = _mm256_movemask_ps(_mm256_cmp_ps(distance, _mm256_mul_ps(reach, reach), _CMP_LT_OQ));
+        if (mask != 0)
+            found = appendSetBits(static_cast<std::uint32_t>(mask), i, hits, found);
+    }
+    _mm256_zeroupper();
+    return sweptCircleOverlapsFrom(i, x0, y0, x1, y1, radius, xs, ys, radii, count, hits, found);
+}
+
+RTYPE_TARGET("avx2")
+std::size_t beamOverlapsAvx2(float x, float y, float length, float halfHeight, const float *xs, const float *ys, const float *radii,
+                             std::size_t count, std::uint32_t *hits)
+{
+    const __m256 startX = _mm256_set1_ps(x);
+    const __m256 endX = _mm256_set1_ps(length + x);
+    const __m256 cy = _mm256_set1_ps(y);
+    const __m256 half = _mm256_set1_ps(halfHeight);
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 px = _mm256_loadu_ps(xs + i);
+        const __m256 r = _mm256_loadu_ps(radii + i);
+        const __m256 dy = _mm256_andnot_ps(sign, _mm256_sub_ps(_mm256_loadu_ps(ys + i), cy));
+        const __m256 inside = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(_mm256_sub_ps(px, r), endX, _CMP_LE_OQ),
+                                                          _mm256_cmp_ps(_mm256_add_ps(px, r), startX, _CMP_GE_OQ)),
+                                            _mm256_cmp_ps(dy, _mm256_add_ps(half, r), _CMP_LE_OQ));
+        const int mask = _mm256_movemask_ps(inside);
+        if (mask != 0)
+            found = appendSetBits(static_cast<std::uint32_t>(mask), i, hits, found);
+    }
+    _mm256_zeroupper();
+    return beamOverlapsFrom(i, x, y, length, halfHeight, xs, ys, radii, count, hits, found);
+}
+
+// ========== AVX-512 (16 lanes) ==========
+
+RTYPE_TARGET("avx512f")
+void integrateAvx512(float *position, const float *velocity, std::size_t lanes, float deltaTime)
+{
+    const __m512 step = _mm512_set1_ps(deltaTime);
+    std::size_t i = 0;
+    for (; i + 16 <= lanes; i += 16)
+        _mm512_storeu_ps(position + i, _mm512_add_ps(_mm512_loadu_ps(position + i), _mm512_mul_ps(_mm512_loadu_ps(velocity + i), step)));
+    _mm256_zeroupper();
+    integrateFrom(i, position, velocity, lanes, deltaTime);
+}
+
+RTYPE_TARGET("avx512f")
+std::size_t outsideBoundsAvx512(const float *points, std::size_t count, Bounds bounds, std::uint32_t *outside)
+{
+    // Even lanes are x, odd lanes are y
+    const __mmask16 xLanes = 0x5555;
+    const __m512 low = _mm512_mask_blend_ps(xLanes, _mm512_set1_ps(bounds.minY), _mm512_set1_ps(bounds.minX));
+    const __m512 high = _mm512_mask_blend_ps(xLanes, _mm512_set1_ps(bounds.maxY), _mm512_set1_ps(bounds.maxX));
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m512 lanes = _mm512_loadu_ps(points + 2 * i);
+        const __mmask16 mask = _mm512_cmp_ps_mask(lanes, low, _CMP_LT_OQ) | _mm512_cmp_ps_mask(lanes, high, _CMP_GT_OQ);
+        if (mask != 0)
+            found = appendSetBits(pairMask(mask), i, outside, found);
+    }
+    _mm256_zeroupper();
+    return outsideBoundsFrom(i, points, count, bounds, outside, found);
+}
+
+RTYPE_TARGET("avx512f")
+std::size_t circleOverlapsAvx512(float x, float y, float radius, const float *xs, const float *ys, const float *radii,
+                                 std::size_t count, std::uint32_t *hits)
+{
+    const __m512 cx = _mm512_set1_ps(x);
+    const __m512 cy = _mm512_set1_ps(y);
+    const __m512 cr = _mm512_set1_ps(radius);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512 dx = _mm512_sub_ps(cx, _mm512_loadu_ps(xs + i));
+        const __m512 dy = _mm512_sub_ps(cy, _mm512_loadu_ps(ys + i));
+        const __m512 reach = _mm512_add_ps(cr, _mm512_loadu_ps(radii + i));
+        const __m512 distance = _mm512_add_ps(_mm512_mul_ps(dx, dx), _mm512_mul_ps(dy, dy));
+        const __mmask16 mask = _mm512_cmp_ps_mask(distance, _mm512_mul_ps(reach, reach), _CMP_LT_OQ);
+        found = appendSetBits(mask, i, hits, found);
+    }
+    _mm256_zeroupper();
+    return circleOverlapsFrom(i, x, y, radius, xs, ys, radii, count, hits, found);
+}
+
+RTYPE_TARGET("avx512f")
+std::size_t sweptCircleOverlapsAvx512(float x0, float y0, float x1, float y1, float radius, const float *xs, const float *ys,
+                                      const float *radii, std::size_t count, std::uint32_t *hits)
+{
+    const float sxScalar = x1 - x0;
+    const float syScalar = y1 - y0;
+    const __m512 ox = _mm512_set1_ps(x0);
+    const __m512 oy = _mm512_set1_ps(y0);
+    const __m512 sx = _mm512_set1_ps(sxScalar);
+    const __m512 sy = _mm512_set1_ps(syScalar);
+    const __m512 lengthSquared = _mm512_set1_ps(sxScalar * sxScalar + syScalar * syScalar);
+    const __m512 cr = _mm512_set1_ps(radius);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 one = _mm512_set1_ps(1.0f);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512 px = _mm512_sub_ps(_mm512_loadu_ps(xs + i), ox);
+        const __m512 py = _mm512_sub_ps(_mm512_loadu_ps(ys + i), oy);
+        __m512 t = _mm512_div_ps(_mm512_add_ps(_mm512_mul_ps(px, sx), _mm512_mul_ps(py, sy)), lengthSquared);
+        t = _mm512_min_ps(_mm512_max_ps(t, zero), one);
+        const __m512 dx = _mm512_sub_ps(px, _mm512_mul_ps(t, sx));
+        const __m512 dy = _mm512_sub_ps(py, _mm512_mul_ps(t, sy));
+        const __m512 reach = _mm512_add_ps(cr, _mm512_loadu_ps(radii + i));
+        const __m512 distance = _mm512_add_ps(_mm512_mul_ps(dx, dx), _mm512_mul_ps(dy, dy));
+        const __mmask16 mask = _mm512_cmp_ps_mask(distance, _mm512_mul_ps(reach, reach), _CMP_LT_OQ);
+        if (mask != 0)
+            found = appendSetBits(mask, i, hits, found);
+    }
+    _mm256_zeroupper();
+    return sweptCircleOverlapsFrom(i, x0, y0, x1, y1, radius, xs, ys, radii, count, hits, found);
+}
+
+RTYPE_TARGET("avx512f")
+std::size_t beamOverlapsAvx512(float x, float y, float length, float halfHeight, const float *xs, const float *ys, const float *radii,
+                               std::size_t count, std::uint32_t *hits)
+{
+    const __m512 startX = _mm512_set1_ps(x);
+    const __m512 endX = _mm512_set1_ps(length + x);
+    const __m512 cy = _mm512_set1_ps(y);
+    const __m512 half = _mm512_set1_ps(halfHeight);
+    std::size_t found = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512 px = _mm512_loadu_ps(xs + i);
+        const __m512 r = _mm512_loadu_ps(radii + i);
+        const __m512 dy = _mm512_abs_ps(_mm512_sub_ps(_mm512_loadu_ps(ys + i), cy));
+        __mmask16 mask = _mm512_cmp_ps_mask(_mm512_sub_ps(px, r), endX, _CMP_LE_OQ);
+        mask = _mm512_mask_cmp_ps_mask(mask, _mm512_add_ps(px, r), startX, _CMP_GE_OQ);
+        mask = _mm512_mask_cmp_ps_mask(mask, dy, _mm512_add_ps(half, r), _CMP_LE_OQ);
+        if (mask != 0)
+            found = appendSetBits(mask, i, hits, found);
+    }
+    _mm256_zeroupper();
+    return beamOverlapsFrom(i, x, y, length, halfHeight, xs, ys, radii, count, hits, found);
+}
+
+#endif
+
+constexpr SimdKernels kScalarKernels{SimdLevel::Scalar, integrateScalar, outsideBoundsScalar, circleOverlapsScalar, sweptCircleOverlapsScalar, beamOverlapsScalar};
+
+#if defined(RTYPE_SIMD_X86)
+constexpr SimdKernels kSse42Kernels{SimdLevel::Sse42, integrateSse42, outsideBoundsSse42, circleOverlapsSse42, sweptCircleOverlapsSse42, beamOverlapsSse42};
+constexpr SimdKernels kAvx2Kernels{SimdLevel::Avx2, integrateAvx2, outsideBoundsAvx2, circleOverlapsAvx2, sweptCircleOverlapsAvx2, beamOverlapsAvx2};
+constexpr SimdKernels kAvx512Kernels{SimdLevel::Avx512, integrateAvx512, outsideBoundsAvx512, circleOverlapsAvx512, sweptCircleOverlapsAvx512, beamOverlapsAvx512};
+#endif
+
+const SimdKernels *kernelsFor(SimdLevel level)
+{
+#if defined(RTYPE_SIMD_X86)
+    switch (level)
+    {
+    case SimdLevel::Avx512:
+        return &kAvx512Kernels;
+    case SimdLevel::Avx2:
+        return &kAvx2Kernels;
+    case SimdLevel::Sse42:
+        return &kSse42Kernels;
+    case SimdLevel::Scalar:
+        break;
+    }
+#endif
+    (void)level;
+    return &kScalarKernels;
+}
+
+std::atomic<const SimdKernels *> g_boundKernels{nullptr};
+
+}
+
+const SimdKernels &simdKernels()
+{
+    const SimdKernels *kernels = g_boundKernels.load(std::memory_order_acquire);
+    if (kernels)
+        return *kernels;
+
+    // First use without selectSimdKernels(): every thread binds the same table
+    kernels = kernelsFor(detectSimdLevel());
+    g_boundKernels.store(kernels, std::memory_order_release);
+    return *kernels;
+}
+
+SimdLevel selectSimdKernels(SimdLevel requested)
+{
+    const SimdLevel level = std::min(requested, detectSimdLevel());
+    g_boundKernels.store(kernelsFor(level), std::memory_order_release);
+    return level;
+}
+
+}
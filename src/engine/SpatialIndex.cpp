@@ -0,0 +1,47 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** SpatialIndex
+*/
+
+#include "rtype/engine/SpatialIndex.hpp"
+
+#include <algorithm>
+
+namespace rtype::engine {
+
+SpatialIndex::SpatialIndex(std::pmr::memory_resource *resource)
+    : _ids(resource), _x(resource), _y(resource), _radius(resource), _builtIds(resource), _grid(resource)
+{
+}
+
+void SpatialIndex::insert(EntityId id, float x, float y, float radius)
+{
+    _ids.push_back(id);
+    _x.push_back(x);
+    _y.push_back(y);
+    _radius.push_back(radius);
+}
+
+void SpatialIndex::build(Bounds area, float cellSize)
+{
+    if (cellSize <= 0.0f)
+    {
+        const float maxRadius = _radius.empty() ? 0.0f : *std::max_element(_radius.begin(), _radius.end());
+        const float areaSize = std::max(area.maxX - area.minX, area.maxY - area.minY);
+        cellSize = std::max(2.0f * maxRadius, areaSize / kMaxCellsPerAxis);
+    }
+
+    _area = area;
+    _grid.build(area, cellSize, _x.data(), _y.data(), _radius.data(), _ids.size());
+
+    // The grid copied the circles; keep the ids its items refer to and recycle the rest
+    _builtIds.swap(_ids);
+    _ids.clear();
+    _x.clear();
+    _y.clear();
+    _radius.clear();
+}
+
+}
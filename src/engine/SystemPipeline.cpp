@@ -9,22 +9,228 @@
 
 #include "rtype/engine/SystemPipeline.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <typeinfo>
+#include <utility>
+
 namespace rtype::engine {
 
+// ========== Cadence ==========
+
+void resolvePhases(std::span<SystemCadence> cadences)
+{
+    // How many already placed systems run on the same tick as (divisor, phase)
+    const auto collisions = [&cadences](std::size_t upTo, std::uint32_t divisor, std::uint32_t phase) {
+        std::size_t count = 0;
+        for (std::size_t j = 0; j < upTo; ++j)
+        {
+            const std::uint32_t other = cadences[j].divisor();
+            if (other == 1)
+                continue;
+            const std::uint32_t common = std::gcd(divisor, other);
+            if (phase % common == cadences[j].phase % common)
+                ++count;
+        }
+        return count;
+    };
+
+    for (std::size_t i = 0; i < cadences.size(); ++i)
+    {
+        auto &cadence = cadences[i];
+        const std::uint32_t divisor = cadence.divisor();
+
+        if (cadence.requested.phase != SystemRate::kAutoPhase)
+        {
+            cadence.phase = cadence.requested.phase % divisor;
+            continue;
+        }
+
+        cadence.phase = 0;
+        if (divisor == 1)
+            continue;
+
+        std::size_t best = collisions(i, divisor, 0);
+        for (std::uint32_t phase = 1; phase < divisor && best != 0; ++phase)
+        {
+            const std::size_t count = collisions(i, divisor, phase);
+            if (count < best)
+            {
+                best = count;
+                cadence.phase = phase;
+            }
+        }
+    }
+}
+
+bool matchesSystemName(std::string_view fullName, std::string_view name)
+{
+    const auto scope = fullName.rfind("::");
+    const std::string_view shortName = scope == std::string_view::npos ? fullName : fullName.substr(scope + 2);
+    return name == fullName || name == shortName;
+}
+
 // ========== System Pipeline ==========
 
+SystemPipeline::SystemPipeline(JobSystem *jobs)
+    : _jobs(jobs)
+{
+}
+
 void SystemPipeline::addSystem(std::unique_ptr<ISystem> system)
 {
+    SystemCadence cadence;
+    cadence.requested = system ? system->rate() : SystemRate{};
+    cadence.ran = !system;
+
+    _names.push_back(system ? prettyTypeName(typeid(*system).name()) : std::string("(null)"));
+    _cadence.push_back(cadence);
     _systems.emplace_back(std::move(system));
+    resolvePhases(_cadence);
+    _scheduleDirty = true;
+    _profilerDirty = true;
+    // The new system's first run may create groups, so it runs sequentially too
+    _warmedUp = false;
+}
+
+bool SystemPipeline::setRate(std::string_view name, SystemRate rate)
+{
+    bool found = false;
+    for (std::size_t i = 0; i < _names.size(); ++i)
+    {
+        if (!matchesSystemName(_names[i], name))
+            continue;
+
+        _cadence[i].requested = rate;
+        found = true;
+    }
+
+    if (found)
+        resolvePhases(_cadence);
+    return found;
+}
+
+SystemRate SystemPipeline::rate(std::size_t index) const
+{
+    return SystemRate{_cadence[index].divisor(), _cadence[index].phase};
+}
+
+const std::string &SystemPipeline::systemName(std::size_t index) const
+{
+    return _names[index];
+}
+
+void SystemPipeline::update(float deltaTime, int &currentLevel, Registry &registry, DestroyQueue &toDestroySet)
+{
+    if (_profilerDirty)
+        rebuildProfilerEntries();
+
+    const auto tickStart = SystemProfiler::Clock::now();
+
+    const std::uint64_t tick = registry.tick();
+    for (auto &cadence : _cadence)
+        cadence.beginTick(tick, deltaTime);
+
+    if (!_jobs || _jobs->workerCount() == 0 || !_warmedUp)
+    {
+        for (std::size_t i = 0; i < _systems.size(); ++i)
+            runSystem(i, currentLevel, registry, toDestroySet);
+        _warmedUp = std::all_of(_cadence.begin(), _cadence.end(), [](const SystemCadence &cadence) { return cadence.ran; });
+    }
+    else
+    {
+        if (_scheduleDirty)
+            buildSchedule();
+
+        for (const auto &stage : _stages)
+        {
+            if (stage.size() == 1)
+            {
+                runSystem(stage.front(), currentLevel, registry, toDestroySet);
+                continue;
+            }
+
+            // One system per chunk
+            _jobs->parallelFor(0, stage.size(), 1, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t i = begin; i < end; ++i)
+                    runSystem(stage[i], currentLevel, registry, toDestroySet);
+            });
+        }
+    }
+
+    registry.advanceTick();
+
+    if (_profiler.enabled())
+    {
+        _profiler.record(_tickEntry, SystemProfiler::Clock::now() - tickStart);
+        _profiler.endTick();
+    }
 }
 
-void SystemPipeline::update(float deltaTime, int &currentLevel, Registry &registry, std::unordered_set<rtype::EntityId> &toDestroySet)
+void SystemPipeline::runSystem(std::size_t index, int &currentLevel, Registry &registry, DestroyQueue &toDestroySet)
 {
-    for (auto &system : _systems)
+    ISystem *system = _systems[index].get();
+    SystemCadence &cadence = _cadence[index];
+    if (!system || !cadence.due)
+        return;
+
+    const float deltaTime = cadence.consume();
+
+    if (!_profiler.enabled())
     {
-        if (system)
-            system->update(deltaTime, currentLevel, registry, toDestroySet);
+        system->update(deltaTime, currentLevel, registry, toDestroySet);
+        return;
     }
+
+    const auto start = SystemProfiler::Clock::now();
+    system->update(deltaTime, currentLevel, registry, toDestroySet);
+    _profiler.record(index, SystemProfiler::Clock::now() - start);
+}
+
+void SystemPipeline::rebuildProfilerEntries()
+{
+    _profiler.clear();
+    for (const auto &name : _names)
+        _profiler.addEntry(name);
+    _tickEntry = _profiler.addEntry("tick");
+    _profilerDirty = false;
+}
+
+void SystemPipeline::buildSchedule()
+{
+    _stages.clear();
+
+    std::vector<SystemAccess> accesses;
+    std::vector<std::size_t> stageOf;
+    accesses.reserve(_systems.size());
+    stageOf.reserve(_systems.size());
+
+    for (std::size_t i = 0; i < _systems.size(); ++i)
+    {
+        if (!_systems[i])
+        {
+            accesses.emplace_back();
+            stageOf.push_back(0);
+            continue;
+        }
+
+        accesses.push_back(_systems[i]->access());
+
+        // Right after the last earlier system it depends on
+        std::size_t stage = 0;
+        for (std::size_t j = 0; j < i; ++j)
+        {
+            if (_systems[j] && accesses[i].conflictsWith(accesses[j]))
+                stage = std::max(stage, stageOf[j] + 1);
+        }
+        stageOf.push_back(stage);
+
+        if (stage >= _stages.size())
+            _stages.resize(stage + 1);
+        _stages[stage].push_back(i);
+    }
+
+    _scheduleDirty = false;
 }
 
 std::size_t SystemPipeline::systemCount() const
@@ -32,9 +238,34 @@ std::size_t SystemPipeline::systemCount() const
     return _systems.size();
 }
 
+std::size_t SystemPipeline::stageCount()
+{
+    if (_scheduleDirty)
+        buildSchedule();
+    return _stages.size();
+}
+
 void SystemPipeline::clear()
 {
     _systems.clear();
+    _names.clear();
+    _cadence.clear();
+    _stages.clear();
+    _scheduleDirty = true;
+    _warmedUp = false;
+    _profilerDirty = true;
+}
+
+SystemProfiler &SystemPipeline::profiler()
+{
+    if (_profilerDirty)
+        rebuildProfilerEntries();
+    return _profiler;
 }
 
-}
\ No newline at end of file
+const SystemProfiler &SystemPipeline::profiler() const
+{
+    return _profiler;
+}
+
+}
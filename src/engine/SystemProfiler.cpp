@@ -0,0 +1,154 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** SystemProfiler
+*/
+
+#include "rtype/engine/SystemProfiler.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace rtype::engine {
+
+// ========== Latency Histogram ==========
+
+std::size_t LatencyHistogram::bucketOf(std::uint64_t value)
+{
+    value = std::min(value, (std::uint64_t{1} << kMaxValueBits) - 1);
+    if (value < (std::uint64_t{1} << kSubBucketBits))
+        return static_cast<std::size_t>(value);
+
+    // Keep the top kSubBucketBits bits: the leading one picks the magnitude
+    const unsigned shift = static_cast<unsigned>(std::bit_width(value)) - kSubBucketBits;
+    const std::size_t sub = static_cast<std::size_t>(value >> shift) - kHalfBucket;
+    return (shift + 1) * kHalfBucket + sub;
+}
+
+std::uint64_t LatencyHistogram::bucketUpperBound(std::size_t bucket)
+{
+    if (bucket < 2 * kHalfBucket)
+        return bucket;
+
+    const std::size_t shift = bucket / kHalfBucket - 1;
+    const std::uint64_t sub = bucket % kHalfBucket + kHalfBucket;
+    return ((sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(std::uint64_t nanoseconds)
+{
+    ++_buckets[bucketOf(nanoseconds)];
+    ++_count;
+    _max = std::max(_max, nanoseconds);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other)
+{
+    for (std::size_t i = 0; i < kBucketCount; ++i)
+        _buckets[i] += other._buckets[i];
+    _count += other._count;
+    _max = std::max(_max, other._max);
+}
+
+void LatencyHistogram::reset()
+{
+    _buckets.fill(0);
+    _count = 0;
+    _max = 0;
+}
+
+std::uint64_t LatencyHistogram::percentile(double quantile) const
+{
+    if (_count == 0)
+        return 0;
+
+    const double clamped = std::clamp(quantile, 0.0, 1.0);
+    const auto target = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(clamped * static_cast<double>(_count))));
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i)
+    {
+        seen += _buckets[i];
+        if (seen >= target)
+            return std::min(bucketUpperBound(i), _max);
+    }
+    return _max;
+}
+
+// ========== System Profiler ==========
+
+std::size_t SystemProfiler::addEntry(std::string name)
+{
+    _entries.push_back(Entry{std::move(name), {}, {}});
+    return _entries.size() - 1;
+}
+
+void SystemProfiler::record(std::size_t entry, Clock::duration elapsed)
+{
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    _entries[entry].current.record(static_cast<std::uint64_t>(std::max<std::int64_t>(nanoseconds, 0)));
+}
+
+void SystemProfiler::endTick()
+{
+    if (++_ticksInWindow < kWindowTicks)
+        return;
+
+    _ticksInWindow = 0;
+    for (auto &entry : _entries)
+    {
+        std::swap(entry.previous, entry.current);
+        entry.current.reset();
+    }
+}
+
+std::vector<SystemTiming> SystemProfiler::snapshot() const
+{
+    std::vector<SystemTiming> timings;
+    timings.reserve(_entries.size());
+
+    for (const auto &entry : _entries)
+    {
+        LatencyHistogram window = entry.previous;
+        window.merge(entry.current);
+
+        SystemTiming timing;
+        timing.name = entry.name;
+        timing.samples = window.count();
+        timing.p50 = window.percentile(0.50);
+        timing.p95 = window.percentile(0.95);
+        timing.p99 = window.percentile(0.99);
+        timing.max = window.max();
+        timings.push_back(std::move(timing));
+    }
+    return timings;
+}
+
+void SystemProfiler::clear()
+{
+    _entries.clear();
+    _ticksInWindow = 0;
+}
+
+// ========== Type Names ==========
+
+std::string prettyTypeName(const char *mangled)
+{
+#if defined(__GNUG__)
+    int status = 0;
+    std::unique_ptr<char, void (*)(void *)> demangled(abi::__cxa_demangle(mangled, nullptr, nullptr, &status), std::free);
+    if (status == 0 && demangled)
+        return demangled.get();
+#endif
+    return mangled;
+}
+
+}
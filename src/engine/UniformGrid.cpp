@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** UniformGrid
+*/
+
+#include "rtype/engine/UniformGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rtype::engine {
+
+UniformGrid::UniformGrid(std::pmr::memory_resource *resource)
+    : _cellStart(resource), _cellOf(resource), _x(resource), _y(resource), _radius(resource), _items(resource)
+{
+}
+
+void UniformGrid::build(Bounds area, float cellSize, const float *xs, const float *ys, const float *radii, std::size_t count)
+{
+    _area = area;
+    _cellSize = std::max(cellSize, 1.0f);
+    _inverseCell = 1.0f / _cellSize;
+    _columns = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil((area.maxX - area.minX) * _inverseCell)));
+    _rows = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil((area.maxY - area.minY) * _inverseCell)));
+
+    // Counting sort: histogram, prefix sums, then scatter
+    _cellStart.assign(_columns * _rows + 1, 0);
+    _cellOf.resize(count);
+    _maxRadius = 0.0f;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        _cellOf[i] = static_cast<std::uint32_t>(rowOf(ys[i]) * _columns + columnOf(xs[i]));
+        ++_cellStart[_cellOf[i] + 1];
+        _maxRadius = std::max(_maxRadius, radii[i]);
+    }
+    for (std::size_t cell = 1; cell < _cellStart.size(); ++cell)
+        _cellStart[cell] += _cellStart[cell - 1];
+
+    _x.resize(count);
+    _y.resize(count);
+    _radius.resize(count);
+    _items.resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // Advances _cellStart[c] to the end of cell c, shifted back below
+        const std::uint32_t slot = _cellStart[_cellOf[i]]++;
+        _x[slot] = xs[i];
+        _y[slot] = ys[i];
+        _radius[slot] = radii[i];
+        _items[slot] = static_cast<std::uint32_t>(i);
+    }
+    for (std::size_t cell = _cellStart.size() - 1; cell > 0; --cell)
+        _cellStart[cell] = _cellStart[cell - 1];
+    _cellStart[0] = 0;
+}
+
+}
@@ -13,6 +13,38 @@
 namespace rtype::server
 {
 
+namespace
+{
+CollisionLayer bodyLayer(Team team)
+{
+    switch (team) {
+        case Team::Player:
+            return CollisionLayer::Player;
+        case Team::Neutral:
+            return CollisionLayer::Neutral;
+        default:
+            return CollisionLayer::Monster;
+    }
+}
+
+CollisionLayer bulletLayer(CollisionLayer owner)
+{
+    switch (owner) {
+        case CollisionLayer::Player:
+            return CollisionLayer::PlayerBullet;
+        case CollisionLayer::Neutral:
+            return CollisionLayer::NeutralBullet;
+        default:
+            return CollisionLayer::MonsterBullet;
+    }
+}
+
+CollisionLayer shieldLayer(CollisionLayer owner)
+{
+    return owner == CollisionLayer::Neutral ? CollisionLayer::NeutralShield : CollisionLayer::MonsterShield;
+}
+}
+
 void EntityFactory::addTransformAndVelocity(EntityId entity, float x, float y, float vx, float vy)
 {
     _registry.addComponent<Transform>(entity, x, y);
@@ -33,10 +65,8 @@ EntityId EntityFactory::spawnPlayer(PlayerId id, float x, float y)
     // Player collision radius based on visual size
     const float playerRadius = _config.gameRender.playerSize * 0.5f;
     _registry.addComponent<Collider>(entity, playerRadius);
-    _registry.addComponent<Hurtbox>(entity);
-    if (!_config.gameplay.friendlyfire) {
-        _registry.addComponent<TeamComponent>(entity, Team::Player);
-    }
+    _registry.addComponent<Hurtbox>(entity, std::nullopt, CollisionLayer::Player);
+    _registry.addComponent<TeamComponent>(entity, Team::Player);
     return entity;
 }
 
@@ -66,13 +96,14 @@ EntityId EntityFactory::spawnMonster(std::uint8_t type, bool canShoot, Team team
 
     _registry.addComponent<WeaponComponent>(entity);
     constexpr std::uint8_t KAMIKAZE_TYPE = 5;
+    const CollisionLayer layer = bodyLayer(team);
     if (type == KAMIKAZE_TYPE) {
-        _registry.addComponent<Hitbox>(entity);
+        _registry.addComponent<Hitbox>(entity, true, layer);
         std::cout << "spawning kamikaze" << std::endl;
     }
     if (canShoot)
         _registry.addComponent<FireCooldown>(entity, 0.0f, 2.0f);
-    _registry.addComponent<Hurtbox>(entity);
+    _registry.addComponent<Hurtbox>(entity, std::nullopt, layer);
     const float startX = x - this->_config.gameplay.bulletSpawnOffsetX;
     const float startY = y - this->_config.gameplay.bulletSpawnOffsetY ;
 
@@ -121,14 +152,14 @@ EntityId EntityFactory::spawnMonster(std::uint8_t type, bool canShoot, Team team
         float shieldX = x + shieldOffsetX;
         float shieldY = y;
         
-        spawnShield(entity, type, shieldX, shieldY, vx, vy);
+        spawnShield(entity, team, type, shieldX, shieldY, vx, vy);
         std::cout << "[EntityFactory] Spawned shield for monster type " << static_cast<int>(type) << std::endl;
     }
     
     return entity;
 }
 
-EntityId EntityFactory::spawnShield(EntityId parentMonster, std::uint8_t type, float x, float y, float vx, float vy)
+EntityId EntityFactory::spawnShield(EntityId parentMonster, Team team, std::uint8_t type, float x, float y, float vx, float vy)
 {
     auto entity = _registry.createEntity();
     
@@ -151,10 +182,10 @@ EntityId EntityFactory::spawnShield(EntityId parentMonster, std::uint8_t type, f
     // Shield collision radius (slightly smaller than monster to position in front)
     const float shieldRadius = size * 0.4f;
     _registry.addComponent<Collider>(entity, shieldRadius);
-    _registry.addComponent<Hurtbox>(entity);
-    auto *parentTeam = _registry.getComponent<TeamComponent>(parentMonster);
-    if (parentTeam)
-        _registry.addComponent<TeamComponent>(entity, parentTeam->team);
+    // Shields are hit like their monster: by the other teams only. The team comes
+    // from the caller, as the parent's components may still be deferred
+    _registry.addComponent<Hurtbox>(entity, std::nullopt, shieldLayer(bodyLayer(team)));
+    _registry.addComponent<TeamComponent>(entity, team);
     return entity;
 }
 
@@ -179,18 +210,24 @@ EntityId EntityFactory::spawnBullet(EntityId owner, bool fromPlayer, float x, fl
         TeamComponent bulletTeam = *ownerTeam;
         _registry.addComponent<TeamComponent>(entity, bulletTeam.team);
     }
+    // Bullets collide as their shooter's side
+    const auto *ownerHurtbox = _registry.getComponent<Hurtbox>(owner);
+    const CollisionLayer layer = ownerHurtbox ? bulletLayer(ownerHurtbox->layer)
+                                              : (fromPlayer ? CollisionLayer::PlayerBullet : CollisionLayer::MonsterBullet);
     // Bullet collision radius based on visual size
     if (weaponType == WeaponType::kWeaponLaserType) {
         float length = _config.gameplay.worldWidth + _config.systems.boundaryMargin;
         float beamHalfHeight = _config.gameRender.bulletSize * 1.5f;
         _registry.addComponent<BeamCollider>(entity, length, beamHalfHeight);
-        _registry.addComponent<Hitbox>(entity, false);
+        _registry.addComponent<Hitbox>(entity, false, layer);
     } else {
         float bulletRadius = _config.gameRender.bulletSize;
         if (weaponType == WeaponType::kWeaponRocketType)
             bulletRadius *= 2.0f;
         _registry.addComponent<Collider>(entity, bulletRadius);
-        _registry.addComponent<Hitbox>(entity, true);
+        _registry.addComponent<Hitbox>(entity, true, layer);
+        // Swept from here on its first collision test, so it cannot skip past a target
+        _registry.addComponent<PreviousTransform>(entity, x, y);
     }
     
     return entity;
@@ -28,12 +28,22 @@ namespace
 
 namespace rtype::server {
 
-GameLogicHandler::GameLogicHandler(config::GameConfig config) 
-    : _config(config), _entityFactory(_registry, _config)
+GameLogicHandler::GameLogicHandler(config::GameConfig config, std::pmr::memory_resource *resource, engine::JobSystem *jobs)
+    : _config(config), _spatialIndex(resource), _registry(resource), _entityFactory(_registry, _config), _systemPipeline(jobs), toDestroySet(resource)
 {
     _currentLevel = 0;
-    initializeSystems();
-    
+    _registry.setJobSystem(jobs);
+    _registry.setSpatialIndex(&_spatialIndex);
+    _systemPipeline.profiler().setEnabled(_config.systems.profileSystems);
+    // Replicated state: GameServer only re-sends entities whose values changed
+    _registry.trackChanges<Transform>();
+    _registry.trackChanges<Health>();
+    _registry.trackChanges<PlayerPowerUpStatus>();
+    if (_config.systems.staticPipeline)
+        initializeStaticPipeline();
+    else
+        initializeSystems();
+    spawnDefaultMonsters();
 }
 
 void GameLogicHandler::initializeSystems()
@@ -53,7 +63,10 @@ void GameLogicHandler::initializeSystems()
         std::cout << "[logic] - FireCooldownSystem loaded\n";
     }
     
-    if (_config.systems.projectileLifetimeSystem) {
+    if (_config.systems.fusedProjectiles) {
+        _systemPipeline.addSystem(std::make_unique<ProjectileSystem>(_config));
+        std::cout << "[logic] - ProjectileSystem loaded (fused lifetime and bounds)\n";
+    } else if (_config.systems.projectileLifetimeSystem) {
         _systemPipeline.addSystem(std::make_unique<ProjectileLifetimeSystem>(_config));
         std::cout << "[logic] - ProjectileLifetimeSystem loaded\n";
     }
@@ -73,6 +86,9 @@ void GameLogicHandler::initializeSystems()
         std::cout << "[logic] - CleanupSystem loaded\n";
     }
 
+    _systemPipeline.addSystem(std::make_unique<SpatialIndexSystem>(_config));
+    std::cout << "[logic] - SpatialIndexSystem loaded\n";
+
     _systemPipeline.addSystem(std::make_unique<PlayerInputSystem>(_config));
     std::cout << "[logic] - PlayerInputSystem loaded\n";
 
@@ -102,6 +118,39 @@ void GameLogicHandler::initializeSystems()
     _systemPipeline.addSystem(std::make_unique<ShieldFollowSystem>(_config));
     std::cout << "[logic] - ShieldFollowSystem loaded\n";
 
+    applySystemRates(_systemPipeline);
+    
+    std::cout << "[logic] System initialization complete\\n";
+}
+
+void GameLogicHandler::initializeStaticPipeline()
+{
+    std::cout << "[logic] Initializing static system pipeline...\n";
+
+    _staticPipeline = std::make_unique<StaticGamePipeline>(_config);
+    _staticPipeline->profiler().setEnabled(_config.systems.profileSystems);
+    _staticPipeline->setEnabled<MovementSystem>(_config.systems.movementSystem);
+    _staticPipeline->setEnabled<FireCooldownSystem>(_config.systems.fireCooldownSystem);
+    _staticPipeline->setEnabled<ProjectileLifetimeSystem>(_config.systems.projectileLifetimeSystem && !_config.systems.fusedProjectiles);
+    _staticPipeline->setEnabled<ProjectileSystem>(_config.systems.fusedProjectiles);
+    _staticPipeline->setEnabled<CollisionSystem>(_config.systems.collisionSystem);
+    _staticPipeline->setEnabled<BoundarySystem>(_config.systems.boundarySystem);
+    _staticPipeline->setEnabled<CleanupSystem>(_config.systems.cleanupSystem);
+    _staticPipeline->setEnabled<LevelSystem>(_config.systems.levelSystem);
+
+    for (std::size_t i = 0; i < _staticPipeline->systemCount(); ++i)
+    {
+        if (_staticPipeline->enabled(i))
+            std::cout << "[logic] - " << _staticPipeline->systemName(i) << " loaded\n";
+    }
+
+    applySystemRates(*_staticPipeline);
+
+    std::cout << "[logic] System initialization complete\n";
+}
+
+void GameLogicHandler::spawnDefaultMonsters()
+{
     for (auto monsters : _config.gameplay.MonstersType) {
         for (auto positions : monsters.second.defaultPositions) {
             float vx, vy;
@@ -110,8 +159,24 @@ void GameLogicHandler::initializeSystems()
             _entityFactory.spawnMonster(monsters.first, monsters.second.canShoot, monsters.second.team, positions.first, positions.second, vx, vy);
         }
     }
-    
-    std::cout << "[logic] System initialization complete\\n";
+}
+
+template <typename Pipeline>
+void GameLogicHandler::applySystemRates(Pipeline &pipeline)
+{
+    for (const auto &[name, rate] : _config.systems.rates)
+    {
+        const std::uint32_t phase = rate.phase < 0 ? engine::SystemRate::kAutoPhase : static_cast<std::uint32_t>(rate.phase);
+        if (!pipeline.setRate(name, engine::SystemRate::every(rate.divisor, phase)))
+            std::cerr << "[logic] Unknown system in [SystemRates]: " << name << '\n';
+    }
+
+    for (std::size_t i = 0; i < pipeline.systemCount(); ++i)
+    {
+        const auto rate = pipeline.rate(i);
+        if (rate.divisor > 1)
+            std::cout << "[logic] - " << pipeline.systemName(i) << " runs every " << rate.divisor << " ticks (phase " << rate.phase << ")\n";
+    }
 }
 
 GameLogicHandler::~GameLogicHandler()
@@ -128,6 +193,13 @@ engine::Registry &GameLogicHandler::getRegistry()
     return this->_registry;
 }
 
+std::vector<engine::SystemTiming> GameLogicHandler::getSystemTimings() const
+{
+    if (_staticPipeline)
+        return _staticPipeline->profiler().snapshot();
+    return _systemPipeline.profiler().snapshot();
+}
+
 EntityId GameLogicHandler::spawnPlayer(PlayerId playerId)
 {
     const float spawnX = _config.gameplay.playerSpawnX;
@@ -152,7 +224,7 @@ void GameLogicHandler::manageInputs(const PlayerInputComponent input, const Enti
 
 void GameLogicHandler::markDestroy(EntityId id)
 {
-    toDestroySet.insert(id);
+    toDestroySet.mark(id);
 }
 
 
@@ -165,7 +237,10 @@ void GameLogicHandler::updateGame(const float dt)
 {
     toDestroySet.clear();
 
-    _systemPipeline.update(dt, _currentLevel, _registry, toDestroySet);
+    if (_staticPipeline)
+        _staticPipeline->update(dt, _currentLevel, _registry, toDestroySet);
+    else
+        _systemPipeline.update(dt, _currentLevel, _registry, toDestroySet);
 
     if (_currentLevel != _prevLevel) {
         _prevLevel = _currentLevel;
@@ -179,7 +254,7 @@ void GameLogicHandler::destroyEntityDestructionList()
         destroyEntity(id);
 }
 
-const std::unordered_set<rtype::EntityId> &GameLogicHandler::getEntityDestructionSet()
+const engine::DestroyQueue &GameLogicHandler::getEntityDestructionSet()
 {
     return this->toDestroySet;
 }
@@ -14,6 +14,8 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <csignal>
+#include <fstream>
 #include <iostream>
 #include <random>
 #include <span>
@@ -22,6 +24,19 @@
 #include <unordered_set>
 #include <cstring>
 
+namespace
+{
+/// Set from the SIGUSR1 handler, consumed by the game loop
+volatile std::sig_atomic_t g_statsDumpRequested = 0;
+
+#ifdef SIGUSR1
+extern "C" void requestStatsDump(int)
+{
+    g_statsDumpRequested = 1;
+}
+#endif
+}
+
 namespace rtype::server
 {
 
@@ -89,7 +104,8 @@ GameServer::GameServer(std::uint16_t port)
     : _ioContext(network::NetworkFactory::createIOContext()),
       _socket(_ioContext->createUdpSocket(port)),
       _config{loadConfig()},
-      _roomManager(std::make_unique<RoomManager>(_config))
+      _roomManager(std::make_unique<RoomManager>(_config)),
+      _timestep(_config.systems.tickRate, _config.systems.maxSubsteps)
 {
 }
 
@@ -105,6 +121,10 @@ void GameServer::start()
 
     scheduleReceive();
 
+#ifdef SIGUSR1
+    std::signal(SIGUSR1, requestStatsDump);
+#endif
+
     _networkThread = std::thread([this]() {
         try
         {
@@ -520,6 +540,11 @@ void GameServer::handleDisconnect(const net::DisconnectNotice &notice, const std
 
 void GameServer::updateGameLoop()
 {
+    const bool fixedStep = _config.systems.fixedTimestep;
+    if (fixedStep)
+        std::cout << "[server] fixed timestep: " << _timestep.tickRate() << " Hz, up to "
+                  << _timestep.maxSubsteps() << " tick(s) per frame\n";
+
     auto previous = std::chrono::steady_clock::now();
 
     while (_running.load())
@@ -539,26 +564,41 @@ void GameServer::updateGameLoop()
                 handlePacket(pending.data.data(), pending.data.size(), std::move(pending.sender));
         }
 
-        _roomManager->updateAllRooms(dt);
+        // Every simulated tick is followed by its own broadcast, which also
+        // destroys the entities the tick marked before the next one runs
+        if (fixedStep)
+        {
+            const std::size_t steps = _timestep.advance(dt);
+            for (std::size_t i = 0; i < steps; ++i)
+            {
+                _roomManager->updateAllRooms(_timestep.step());
+                broadcastRoomStates(nowMilliseconds());
+            }
+        }
+        else
+        {
+            _roomManager->updateAllRooms(dt);
+            broadcastRoomStates(nowMilliseconds());
+        }
+
         _roomManager->cleanupEmptyRooms();
         
         // Check for client timeouts
         checkClientTimeouts();
-
-        const auto timestamp = nowMilliseconds();
-        broadcastRoomStates(timestamp);
+        maybeDumpRoomStats(dt);
 
         const auto frameEnd = std::chrono::steady_clock::now();
         const float frameElapsed = std::chrono::duration<float>(frameEnd - now).count();
-        constexpr float kTargetDelta = 1.0f / 60.0f;
-        if (frameElapsed < kTargetDelta)
-            std::this_thread::sleep_for(std::chrono::duration<float>(kTargetDelta - frameElapsed));
+        const float targetDelta = fixedStep ? _timestep.timeUntilNextTick() : 1.0f / 60.0f;
+        if (frameElapsed < targetDelta)
+            std::this_thread::sleep_for(std::chrono::duration<float>(targetDelta - frameElapsed));
     }
 }
 
 void GameServer::broadcastRoomStates(Timestamp timestamp)
 {
     auto rooms = _roomManager->listRooms();
+    const bool fullState = (_broadcastCount++ % kFullStateInterval) == 0;
     
     for (const auto& roomInfo : rooms)
     {
@@ -570,6 +610,11 @@ void GameServer::broadcastRoomStates(Timestamp timestamp)
         const auto& toDestroy = room->getGameLogic().getEntityDestructionSet();
         const auto& clients = room->getClients();
 
+        // Entities untouched since the last broadcast are skipped between full refreshes
+        const auto needsUpdate = [&](EntityId id, bool marked) {
+            return fullState || marked || registry.wasChanged<Transform>(id) || registry.wasChanged<Health>(id);
+        };
+
         // Debug output every 60 frames per room (using timestamp instead of static counter)
         if ((timestamp / 16) % 60 == 0 && roomInfo.roomId == 1)  // Only room 1 for less spam
         {
@@ -642,12 +687,14 @@ void GameServer::broadcastRoomStates(Timestamp timestamp)
         }
 
         registry.each<MonsterComponent>([&](EntityId id, const MonsterComponent &monster) {
-            const auto *transform = registry.get<const Transform>(id);
+            const auto *transform = registry.get<Transform>(id);
             const auto *velocity = registry.get<Velocity>(id);
             const auto *health = registry.get<Health>(id);
             if (!transform || !health)
                 return;
-            const bool marked = toDestroy.count(id) > 0;
+            const bool marked = toDestroy.contains(id);
+            if (!needsUpdate(id, marked))
+                return;
             net::MonsterState state{};
             state.id = id;
             state.type = monster.type;
@@ -662,12 +709,14 @@ void GameServer::broadcastRoomStates(Timestamp timestamp)
         });
 
         registry.each<ShieldComponent>([&](EntityId id, const ShieldComponent &shield) {
-            const auto *transform = registry.get<const Transform>(id);
+            const auto *transform = registry.get<Transform>(id);
             const auto *velocity = registry.get<Velocity>(id);
             const auto *health = registry.get<Health>(id);
             if (!transform || !health)
                 return;
-            const bool marked = toDestroy.count(id) > 0;
+            const bool marked = toDestroy.contains(id);
+            if (!needsUpdate(id, marked))
+                return;
             
             // Get shield type from parent monster
             std::uint8_t shieldType = 0;
@@ -693,7 +742,9 @@ void GameServer::broadcastRoomStates(Timestamp timestamp)
             const auto *transform = registry.get<Transform>(id);
             if (!transform)
                 return;
-            const bool marked = toDestroy.count(id) > 0;
+            const bool marked = toDestroy.contains(id);
+            if (!needsUpdate(id, marked))
+                return;
             net::PowerUpState state{};
             state.id = id;
             state.type = powerup.type;
@@ -710,7 +761,9 @@ void GameServer::broadcastRoomStates(Timestamp timestamp)
             const auto *transform = registry.get<Transform>(id);
             if (!transform)
                 return;
-            const bool marked = toDestroy.count(id) > 0;
+            const bool marked = toDestroy.contains(id);
+            if (!needsUpdate(id, marked))
+                return;
             net::BulletState bullet{};
             bullet.id = id;
             bullet.x = transform->x;
@@ -724,6 +777,7 @@ void GameServer::broadcastRoomStates(Timestamp timestamp)
                 flushSends(packet, client.getEndpoint());
         });
         room->getGameLogic().destroyEntityDestructionList();
+        room->getGameLogic().getRegistry().clearChanged();
     }
 }
 
@@ -809,4 +863,42 @@ void GameServer::checkClientTimeouts()
     }
 }
 
+void GameServer::maybeDumpRoomStats(float dt)
+{
+    bool dump = g_statsDumpRequested != 0;
+    
+    const float interval = _config.network.statsDumpInterval;
+    if (interval > 0.0f)
+    {
+        _statsDumpTimer += dt;
+        if (_statsDumpTimer >= interval)
+        {
+            _statsDumpTimer = 0.0f;
+            dump = true;
+        }
+    }
+    
+    if (!dump)
+        return;
+    
+    g_statsDumpRequested = 0;
+    if (_config.systems.fixedTimestep)
+        std::cout << "[server] tick=" << _timestep.tick() << " dropped=" << _timestep.droppedTicks()
+                  << " alpha=" << _timestep.alpha() << "\n";
+    _roomManager->dumpRoomStats(std::cout);
+    
+    const std::string &csvPath = _config.network.profileCsvPath;
+    if (csvPath.empty())
+        return;
+    
+    std::ofstream csv(csvPath, std::ios::app);
+    if (!csv)
+    {
+        std::cerr << "[server] cannot open profile CSV " << csvPath << '\n';
+        return;
+    }
+    csv.seekp(0, std::ios::end);
+    _roomManager->writeSystemTimingsCsv(csv, nowMilliseconds(), csv.tellp() == 0);
+}
+
 }
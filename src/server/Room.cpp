@@ -11,12 +11,13 @@
 namespace rtype::server
 {
 
-Room::Room(RoomId id, PlayerId hostId, const std::string& roomName, const config::GameConfig& config)
+Room::Room(RoomId id, PlayerId hostId, const std::string& roomName, const config::GameConfig& config,
+    engine::JobSystem* jobs)
     : _roomId(id)
     , _roomName(roomName)
     , _hostId(hostId)
     , _state(RoomState::Waiting)
-    , _gameLogic(config)
+    , _gameLogic(config, _arena.resource(), jobs)
     , _config(config)
 {
     std::cout << "[room:" << _roomId << "] Created room '" << _roomName 
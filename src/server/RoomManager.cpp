@@ -6,7 +6,9 @@
 */
 
 #include "rtype/server/RoomManager.hpp"
+#include "rtype/engine/SimdKernels.hpp"
 #include <iostream>
+#include <iomanip>
 #include <algorithm>
 
 namespace rtype::server
@@ -15,6 +17,24 @@ namespace rtype::server
 RoomManager::RoomManager(const config::GameConfig& config)
     : _config(config)
 {
+    if (_config.systems.workerThreads > 0)
+    {
+        _jobs = std::make_unique<engine::JobSystem>(_config.systems.workerThreads);
+        std::cout << "[room-manager] Running systems on " << _config.systems.workerThreads << " worker thread(s)\n";
+    }
+
+    const engine::SimdLevel detected = engine::detectSimdLevel();
+    engine::SimdLevel requested = detected;
+    if (_config.systems.simdKernels != "auto")
+    {
+        if (auto forced = engine::parseSimdLevel(_config.systems.simdKernels))
+            requested = *forced;
+        else
+            std::cerr << "[room-manager] Unknown SimdKernels \"" << _config.systems.simdKernels << "\", using auto\n";
+    }
+    const engine::SimdLevel bound = engine::selectSimdKernels(requested);
+    std::cout << "[room-manager] SIMD kernels: " << engine::simdLevelName(bound)
+              << " (cpu supports " << engine::simdLevelName(detected) << ")\n";
 }
 
 RoomId RoomManager::createRoom(const std::string& roomName, PlayerId hostId)
@@ -22,7 +42,7 @@ RoomId RoomManager::createRoom(const std::string& roomName, PlayerId hostId)
     std::lock_guard<std::mutex> lock(_mutex);
     
     RoomId roomId = _nextRoomId++;
-    auto room = std::make_shared<Room>(roomId, hostId, roomName, _config);
+    auto room = std::make_shared<Room>(roomId, hostId, roomName, _config, _jobs.get());
     _rooms.emplace(roomId, room);
     
     std::cout << "[room-manager] Created room " << roomId << " '" << roomName << "'\n";
@@ -141,6 +161,86 @@ std::vector<RoomInfo> RoomManager::listRooms() const
     return rooms;
 }
 
+std::vector<RoomStats> RoomManager::collectRoomStats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    
+    std::vector<RoomStats> stats;
+    stats.reserve(_rooms.size());
+    
+    for (const auto& [id, room] : _rooms)
+    {
+        RoomStats roomStats;
+        roomStats.roomId = id;
+        roomStats.roomName = room->getName();
+        roomStats.playerCount = room->getPlayerCount();
+        roomStats.state = room->getState();
+        roomStats.registry = room->getGameLogic().getRegistry().stats();
+        roomStats.systems = room->getGameLogic().getSystemTimings();
+        stats.push_back(std::move(roomStats));
+    }
+    
+    std::sort(stats.begin(), stats.end(), [](const RoomStats& a, const RoomStats& b) {
+        return a.roomId < b.roomId;
+    });
+    return stats;
+}
+
+void RoomManager::dumpRoomStats(std::ostream& out) const
+{
+    const auto stats = collectRoomStats();
+    out << "[room-manager] Registry stats for " << stats.size() << " room(s)\n";
+    
+    for (const auto& room : stats)
+    {
+        const auto& registry = room.registry;
+        out << "[room:" << room.roomId << "] '" << room.roomName << "' players=" << room.playerCount
+            << " tick=" << registry.tick << " entities=" << registry.liveEntities << " slots=" << registry.entitySlots
+            << " free=" << registry.freeSlots << " pending=" << registry.pendingCommands
+            << " groups=" << registry.groups << " changes=" << registry.trackedChanges
+            << " bytes=" << registry.totalBytesUsed() << "/" << registry.totalBytesReserved() << "\n";
+        
+        for (const auto& storage : registry.storages)
+        {
+            out << "[room:" << room.roomId << "]   #" << storage.typeId << " " << storage.typeName
+                << " (" << storage.backend << ") count=" << storage.count
+                << " capacity=" << storage.capacity
+                << " bytes=" << storage.bytesUsed << "/" << storage.bytesReserved
+                << std::fixed << std::setprecision(2)
+                << " load=" << storage.loadFactor()
+                << " frag=" << storage.fragmentation()
+                << std::defaultfloat << "\n";
+        }
+        
+        for (const auto& system : room.systems)
+        {
+            if (system.samples == 0)
+                continue;
+            out << "[room:" << room.roomId << "]   " << system.name << " n=" << system.samples
+                << std::fixed << std::setprecision(1)
+                << " p50=" << system.p50 / 1000.0 << "us p95=" << system.p95 / 1000.0
+                << "us p99=" << system.p99 / 1000.0 << "us max=" << system.max / 1000.0 << "us"
+                << std::defaultfloat << "\n";
+        }
+    }
+}
+
+void RoomManager::writeSystemTimingsCsv(std::ostream& out, Timestamp now, bool header) const
+{
+    if (header)
+        out << "timestamp_ms,room,system,samples,p50_us,p95_us,p99_us,max_us\n";
+    
+    for (const auto& room : collectRoomStats())
+    {
+        for (const auto& system : room.systems)
+        {
+            out << now << ',' << room.roomId << ',' << system.name << ',' << system.samples
+                << ',' << system.p50 / 1000.0 << ',' << system.p95 / 1000.0
+                << ',' << system.p99 / 1000.0 << ',' << system.max / 1000.0 << '\n';
+        }
+    }
+}
+
 void RoomManager::updateAllRooms(float dt)
 {
     std::lock_guard<std::mutex> lock(_mutex);
@@ -12,7 +12,7 @@
 namespace rtype::server
 {
 
-void Boss2BehaviorSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId>&)
+void Boss2BehaviorSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &)
 {
     registry.view<Boss2Behavior, Transform>([&](EntityId id, Boss2Behavior &behavior, Transform &transform) {
         // Update oscillation timer for smooth movement when visible
@@ -20,6 +20,7 @@ void Boss2BehaviorSystem::update(float deltaTime, int &currentLevel, engine::Reg
             behavior.oscillationTimer += deltaTime * behavior.oscillationSpeed;
             float offset = std::sin(behavior.oscillationTimer) * behavior.oscillationAmplitude;
             transform.y = behavior.baseY + offset;
+            registry.markChanged<Transform>(id);
         }
         
         // Update visibility timer for teleport effect
@@ -37,10 +38,17 @@ void Boss2BehaviorSystem::update(float deltaTime, int &currentLevel, engine::Reg
                 float randomRatio = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
                 behavior.baseY = minY + randomRatio * (maxY - minY);
                 transform.y = behavior.baseY;
+                registry.markChanged<Transform>(id);
                 behavior.oscillationTimer = 0.0f; // Reset oscillation
             }
         }
     });
 }
 
+engine::SystemAccess Boss2BehaviorSystem::access() const
+{
+    return engine::SystemAccess{}
+        .write<Boss2Behavior, Transform>();
+}
+
 }
\ No newline at end of file
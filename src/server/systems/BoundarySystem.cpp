@@ -7,6 +7,7 @@
 
 #include "rtype/server/systems/BoundarySystem.hpp"
 #include "rtype/common/Components.hpp"
+#include "rtype/engine/SimdKernels.hpp"
 
 namespace rtype::server
 {
@@ -15,23 +16,40 @@ namespace rtype::server
 // BoundarySystem
 BoundarySystem::BoundarySystem(const config::GameConfig &config)
     : ISystem(config), _worldWidth(config.gameplay.worldWidth), _worldHeight(config.gameplay.worldHeight), 
-      _margin(config.systems.boundaryMargin){}
-void BoundarySystem::update(float, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &_destroySet)
+      _margin(config.systems.boundaryMargin), _skipProjectiles(config.systems.fusedProjectiles){}
+void BoundarySystem::update(float, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &_destroySet)
 {
-    registry.forEach<Transform>([&](EntityId id, Transform &transform) {
-        bool isPlayer = registry.hasComponent<PlayerComponent>(id);
-        
-        if (isPlayer) {
-            if (transform.x < 0.0f) transform.x = 0.0f;
-            if (transform.x > _worldWidth) transform.x = _worldWidth;
-            if (transform.y < 0.0f) transform.y = 0.0f;
-            if (transform.y > _worldHeight) transform.y = _worldHeight;
-        } else {
-            if (transform.x < -_margin || transform.x > _worldWidth + _margin ||
-                transform.y < -_margin || transform.y > _worldHeight + _margin) {
-                _destroySet.insert(id);
-            }
-        }
+    registry.view<Transform, PlayerComponent>([&](EntityId id, Transform &transform, PlayerComponent &) {
+        const Transform before = transform;
+        if (transform.x < 0.0f) transform.x = 0.0f;
+        if (transform.x > _worldWidth) transform.x = _worldWidth;
+        if (transform.y < 0.0f) transform.y = 0.0f;
+        if (transform.y > _worldHeight) transform.y = _worldHeight;
+        if (transform.x != before.x || transform.y != before.y)
+            registry.markChanged<Transform>(id);
     });
+
+    auto &bodies = registry.group<Transform, Velocity>();
+    const engine::Bounds bounds{-_margin, -_margin, _worldWidth + _margin, _worldHeight + _margin};
+
+    _outside.resize(bodies.size());
+    const std::size_t found = engine::outsideBounds(&bodies.raw<Transform>()->x, bodies.size(), bounds, _outside.data());
+
+    for (std::size_t i = 0; i < found; ++i)
+    {
+        const EntityId id = bodies.entities()[_outside[i]];
+        if (registry.hasComponent<PlayerComponent>(id) || (_skipProjectiles && registry.hasComponent<Projectile>(id)))
+            continue;
+        _destroySet.mark(id);
+    }
 }
+
+engine::SystemAccess BoundarySystem::access() const
+{
+    return engine::SystemAccess{}
+        .read<PlayerComponent>()
+        .write<Transform>()
+        .usesDestroyList();
+}
+
 }
\ No newline at end of file
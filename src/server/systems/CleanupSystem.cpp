@@ -11,12 +11,20 @@
 namespace rtype::server
 {
 
-void CleanupSystem::update(float, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &destroySet)
+void CleanupSystem::update(float, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &destroySet)
 {
     registry.forEach<Health>([&](EntityId id, const Health &health) {
         if (!health.alive || health.hp == 0) {
-            destroySet.insert(id);
+            destroySet.mark(id);
         }
     });
 }
+
+engine::SystemAccess CleanupSystem::access() const
+{
+    return engine::SystemAccess{}
+        .read<Health>()
+        .usesDestroyList();
+}
+
 }
\ No newline at end of file
@@ -6,65 +6,206 @@
 */
 
 #include "rtype/server/systems/CollisionSystem.hpp"
+#include "rtype/engine/SimdKernels.hpp"
+#include <algorithm>
+#include <bit>
 #include <cmath>
 #include <iostream>
+#include <limits>
 
 
 namespace rtype::server
 {
 
-void CollisionSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroySet)
+namespace
 {
-    registry.view<Hitbox, Transform>([&](EntityId hitboxId, Hitbox &hitbox, Transform &hitboxTransform) {
-        registry.view<Hurtbox, Transform>([&](EntityId hurtboxId, Hurtbox &hurtbox, Transform &hurtboxTransform) {
-            auto *hitboxTeam = registry.getComponent<TeamComponent>(hitboxId);
-            auto *hurtboxTeam = registry.getComponent<TeamComponent>(hurtboxId);
-            if (hitboxId == hurtboxId || (hitboxTeam && hurtboxTeam && (hitboxTeam->team == hurtboxTeam->team)))
-                return;
-            
-            
-            Collider *hitboxCircleCollider  = registry.getComponent<Collider>(hitboxId);
-            Collider *hurtboxCircleCollider  = registry.getComponent<Collider>(hurtboxId);
-            if (hitboxCircleCollider) {
-                if (circleVsCircle(hitboxTransform, hitboxCircleCollider->radius, hurtboxTransform, hurtboxCircleCollider->radius)) {
-                    hurtbox.collidedWith = hitboxId;
-                    if (hitbox.destroyOnHit) {
-                        toDestroySet.insert(hitboxId);
-                    }
+/**
+ * @brief Fraction of the move from `from` to `to` at which a circle first comes within reach of (x, y)
+ *
+ * Only called on pairs sweptCircleOverlaps() reported, so the move is not
+ * zero-length and the path does reach the point.
+ */
+float entryTime(const PreviousTransform &from, const Transform &to, float reach, float x, float y)
+{
+    const float sx = to.x - from.x;
+    const float sy = to.y - from.y;
+    const float dx = x - from.x;
+    const float dy = y - from.y;
+    const float startGap = dx * dx + dy * dy - reach * reach;
+    if (startGap < 0.0f)
+        return 0.0f;
+
+    const float along = dx * sx + dy * sy;
+    const float lengthSquared = sx * sx + sy * sy;
+    // Rounding can leave a grazing contact just below zero
+    const float discriminant = std::max(along * along - lengthSquared * startGap, 0.0f);
+    return (along - std::sqrt(discriminant)) / lengthSquared;
+}
+}
+
+CollisionSystem::CollisionSystem(const config::GameConfig &config)
+    : ISystem(config), _world{0.0f, 0.0f, config.gameplay.worldWidth, config.gameplay.worldHeight},
+      _layers(config.systems.collisionLayers)
+{
+    if (config.gameplay.friendlyfire)
+        _layers.allow(CollisionLayer::PlayerBullet, CollisionLayer::Player);
+}
+
+void CollisionSystem::HurtboxColumns::clear()
+{
+    x.clear();
+    y.clear();
+    radius.clear();
+    ids.clear();
+    hurtboxes.clear();
+    gridded = false;
+}
+
+void CollisionSystem::gatherHurtboxes(engine::Registry &registry)
+{
+    for (auto &bucket : _hurtboxes)
+        bucket.clear();
+
+    registry.group<Hurtbox>(engine::observe<Transform, Collider>).each([&](EntityId hurtboxId, Hurtbox &hurtbox, Transform &hurtboxTransform, Collider &hurtboxCollider) {
+        HurtboxColumns &bucket = _hurtboxes[static_cast<std::size_t>(hurtbox.layer)];
+        bucket.x.push_back(hurtboxTransform.x);
+        bucket.y.push_back(hurtboxTransform.y);
+        bucket.radius.push_back(hurtboxCollider.radius);
+        bucket.ids.push_back(hurtboxId);
+        bucket.hurtboxes.push_back(&hurtbox);
+    });
+
+    // Cells about as wide as the biggest hurtbox, without exceeding kMaxCellsPerAxis per axis;
+    // a handful of hurtboxes get no grid at all, as one scan of the columns beats building one
+    const float worldSize = std::max(_world.maxX - _world.minX, _world.maxY - _world.minY);
+    std::size_t largest = 0;
+    _populated = 0;
+    for (std::size_t layer = 0; layer < kCollisionLayerCount; ++layer) {
+        HurtboxColumns &bucket = _hurtboxes[layer];
+        if (bucket.size() == 0)
+            continue;
+
+        bucket.gridded = bucket.size() >= kGridMinHurtboxes;
+        if (bucket.gridded) {
+            const float maxRadius = *std::max_element(bucket.radius.begin(), bucket.radius.end());
+            const float cellSize = std::max(2.0f * maxRadius, worldSize / kMaxCellsPerAxis);
+            bucket.grid.build(_world, cellSize, bucket.x.data(), bucket.y.data(), bucket.radius.data(), bucket.size());
+        }
+        _populated |= layerBit(static_cast<CollisionLayer>(layer));
+        largest = std::max(largest, bucket.size());
+    }
+    _hits.resize(largest);
+}
+
+void CollisionSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroySet)
+{
+    gatherHurtboxes(registry);
+    if (_populated == 0)
+        return;
+
+    // Runs kernel(x, y, radius, count, hits) on the hurtboxes reach may touch: the rows of
+    // cells it spans, or the whole columns of an ungridded bucket; onHit gets column indices
+    const auto narrowphase = [this](const HurtboxColumns &bucket, const engine::Bounds &reach, auto &&kernel, auto &&onHit) {
+        if (!bucket.gridded) {
+            const std::size_t found = kernel(bucket.x.data(), bucket.y.data(), bucket.radius.data(), bucket.size(), _hits.data());
+            for (std::size_t i = 0; i < found; ++i)
+                onHit(_hits[i]);
+            return;
+        }
+        bucket.grid.query(reach, [&](const engine::UniformGrid::Slice &cells) {
+            const std::size_t found = kernel(cells.x, cells.y, cells.radius, cells.count, _hits.data());
+            for (std::size_t i = 0; i < found; ++i)
+                onHit(cells.items[_hits[i]]);
+        });
+    };
+
+    registry.group<Hitbox>(engine::observe<Transform>).each([&](EntityId hitboxId, Hitbox &hitbox, Transform &hitboxTransform) {
+        // The sweep runs from where the previous test left the hitbox, so a decimated
+        // run still covers every tick of movement; that start is advanced right away
+        PreviousTransform *previous = registry.getComponent<PreviousTransform>(hitboxId);
+        const PreviousTransform from = previous ? *previous : PreviousTransform{hitboxTransform.x, hitboxTransform.y};
+        if (previous)
+            *previous = PreviousTransform{hitboxTransform.x, hitboxTransform.y};
+
+        // Whole bucket pairs the matrix rules out are skipped before any lookup
+        std::uint32_t targets = _layers.hits[static_cast<std::size_t>(hitbox.layer)] & _populated;
+        if (targets == 0)
+            return;
+
+        Collider *hitboxCircleCollider = registry.getComponent<Collider>(hitboxId);
+        BeamCollider *hitboxBeamCollider = hitboxCircleCollider ? nullptr : registry.getComponent<BeamCollider>(hitboxId);
+        if (!hitboxCircleCollider && !hitboxBeamCollider)
+            return;
+        const bool swept = from.x != hitboxTransform.x || from.y != hitboxTransform.y;
+
+        // A bullet that dies on its first hit only reaches the hurtbox it enters first
+        // along its sweep, across every bucket; lasers and piercing hitboxes hit them all
+        const bool firstContactOnly = hitboxCircleCollider && swept && hitbox.destroyOnHit;
+        HurtboxColumns *firstBucket = nullptr;
+        std::size_t firstIndex = 0;
+        float firstTime = std::numeric_limits<float>::infinity();
+
+        const auto hit = [&](HurtboxColumns &bucket, std::size_t index) {
+            bucket.hurtboxes[index]->collidedWith = hitboxId;
+            if (hitbox.destroyOnHit) {
+                toDestroySet.mark(hitboxId);
+            }
+        };
+
+        for (; targets != 0; targets &= targets - 1) {
+            HurtboxColumns &bucket = _hurtboxes[static_cast<std::size_t>(std::countr_zero(targets))];
+
+            const auto onHit = [&](std::size_t index) {
+                if (bucket.ids[index] == hitboxId)
+                    return;
+                if (!firstContactOnly) {
+                    hit(bucket, index);
+                    return;
                 }
-            } else {
-                BeamCollider *hitboxBeamCollider = registry.getComponent<BeamCollider>(hitboxId);
-                if (hitboxBeamCollider && beamVsCircle(hitboxTransform, hitboxBeamCollider->length, hitboxBeamCollider->halfHeight, hurtboxTransform, hurtboxCircleCollider->radius)) {
-                    hurtbox.collidedWith = hitboxId;
-                    if (hitbox.destroyOnHit) {
-                        toDestroySet.insert(hitboxId);
-                    }
+
+                const float time = entryTime(from, hitboxTransform, hitboxCircleCollider->radius + bucket.radius[index], bucket.x[index], bucket.y[index]);
+                if (time < firstTime) {
+                    firstTime = time;
+                    firstBucket = &bucket;
+                    firstIndex = index;
                 }
+            };
+
+            if (hitboxCircleCollider && swept) {
+                // Capsule covered by the circle since its last test: no tunneling at low tick rates
+                const float radius = hitboxCircleCollider->radius;
+                const engine::Bounds reach{std::min(from.x, hitboxTransform.x) - radius, std::min(from.y, hitboxTransform.y) - radius,
+                                           std::max(from.x, hitboxTransform.x) + radius, std::max(from.y, hitboxTransform.y) + radius};
+                narrowphase(bucket, reach, [&](const float *xs, const float *ys, const float *radii, std::size_t count, std::uint32_t *hits) {
+                    return engine::sweptCircleOverlaps(from.x, from.y, hitboxTransform.x, hitboxTransform.y, radius, xs, ys, radii, count, hits);
+                }, onHit);
+            } else if (hitboxCircleCollider) {
+                const float radius = hitboxCircleCollider->radius;
+                const engine::Bounds reach{hitboxTransform.x - radius, hitboxTransform.y - radius, hitboxTransform.x + radius, hitboxTransform.y + radius};
+                narrowphase(bucket, reach, [&](const float *xs, const float *ys, const float *radii, std::size_t count, std::uint32_t *hits) {
+                    return engine::circleOverlaps(hitboxTransform.x, hitboxTransform.y, radius, xs, ys, radii, count, hits);
+                }, onHit);
+            } else {
+                const engine::Bounds reach{hitboxTransform.x, hitboxTransform.y - hitboxBeamCollider->halfHeight,
+                                           hitboxTransform.x + hitboxBeamCollider->length, hitboxTransform.y + hitboxBeamCollider->halfHeight};
+                narrowphase(bucket, reach, [&](const float *xs, const float *ys, const float *radii, std::size_t count, std::uint32_t *hits) {
+                    return engine::beamOverlaps(hitboxTransform.x, hitboxTransform.y, hitboxBeamCollider->length, hitboxBeamCollider->halfHeight,
+                                                xs, ys, radii, count, hits);
+                }, onHit);
             }
-        });
+        }
+
+        if (firstBucket)
+            hit(*firstBucket, firstIndex);
     });
 }
 
-
-
-inline bool CollisionSystem::beamVsCircle(const Transform &projectileTransform, float beamLength, float beamHalfHeight, Transform &monsterTransform, float monsterRadius)
+engine::SystemAccess CollisionSystem::access() const
 {
-    float beamStartX = projectileTransform.x;
-    float beamEndX = beamLength + beamStartX;
-
-    bool collided = false;
-    bool overlapsX = (monsterTransform.x - monsterRadius) <= beamEndX &&
-                        (monsterTransform.x + monsterRadius) >= beamStartX;
-    bool overlapsY = std::fabs(monsterTransform.y - projectileTransform.y) <= (beamHalfHeight + monsterRadius);
-    return (overlapsX && overlapsY);
+    return engine::SystemAccess{}
+        .read<Hitbox, Transform, Collider, BeamCollider>()
+        .write<Hurtbox, PreviousTransform>()
+        .usesDestroyList();
 }
 
-inline bool CollisionSystem::circleVsCircle(
-const Transform& a, float ra,
-const Transform& b, float rb)
-{
-    float dx = a.x - b.x;
-    float dy = a.y - b.y;
-    return dx * dx + dy * dy < (ra + rb) * (ra + rb);
 }
-}
\ No newline at end of file
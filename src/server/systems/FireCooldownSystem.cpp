@@ -12,9 +12,9 @@ namespace rtype::server
 {
 
 // FireCooldownSystem
-void FireCooldownSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &)
+void FireCooldownSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &)
 {
-    registry.forEach<FireCooldown>([&](EntityId, FireCooldown &cooldown) {
+    registry.parallelForEach<FireCooldown>([&](EntityId, FireCooldown &cooldown) {
         if (cooldown.timer > 0.0f) {
             cooldown.timer -= deltaTime;
             if (cooldown.timer < 0.0f) {
@@ -23,4 +23,11 @@ void FireCooldownSystem::update(float deltaTime, int &currentLevel, engine::Regi
         }
     });
 }
+
+engine::SystemAccess FireCooldownSystem::access() const
+{
+    return engine::SystemAccess{}
+        .write<FireCooldown>();
+}
+
 }
\ No newline at end of file
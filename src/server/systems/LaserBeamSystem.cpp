@@ -9,7 +9,7 @@
 
 
 namespace rtype::server {
-void LaserBeamSystem::update(float, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroySet)
+void LaserBeamSystem::update(float, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroySet)
 {
     registry.forEach<PlayerComponent>([&](EntityId playerId, PlayerComponent &) {
         auto *weapon = registry.get<WeaponComponent>(playerId);
@@ -28,7 +28,13 @@ void LaserBeamSystem::update(float, int &currentLevel, engine::Registry &registr
             return;
         }
 
-        auto *beamTransform = registry.get<Transform>(weapon->activeLaserId);
+        // Handles are versioned: a recycled beam slot fails this single compare
+        if (!registry.entityExists(weapon->activeLaserId)) {
+            stopLaser(registry, *weapon, toDestroySet);
+            return;
+        }
+
+        auto *beamTransform = registry.patch<Transform>(weapon->activeLaserId);
         auto *beamVelocity = registry.get<Velocity>(weapon->activeLaserId);
         auto *projectile = registry.get<Projectile>(weapon->activeLaserId);
         if (!beamTransform || !projectile) {
@@ -45,10 +51,18 @@ void LaserBeamSystem::update(float, int &currentLevel, engine::Registry &registr
     });
 }
 
-void LaserBeamSystem::stopLaser(engine::Registry &registry, WeaponComponent &weapon, std::unordered_set<rtype::EntityId> &toDestroySet)
+engine::SystemAccess LaserBeamSystem::access() const
+{
+    return engine::SystemAccess{}
+        .read<PlayerComponent, Health, Projectile>()
+        .write<WeaponComponent, Transform, Velocity>()
+        .usesDestroyList();
+}
+
+void LaserBeamSystem::stopLaser(engine::Registry &registry, WeaponComponent &weapon, engine::DestroyQueue &toDestroySet)
 {
-    if (weapon.activeLaserId != 0 && registry.entityExists(weapon.activeLaserId))
-        toDestroySet.insert(weapon.activeLaserId);
+    if (registry.entityExists(weapon.activeLaserId))
+        toDestroySet.mark(weapon.activeLaserId);
     weapon.activeLaserId = 0;
     weapon.laserActive = false;
 }
@@ -23,7 +23,7 @@ MonsterSpawnerSystem::MonsterSpawnerSystem(const config::GameConfig &config)
     }
 }
 
-void MonsterSpawnerSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &)
+void MonsterSpawnerSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &)
 {
     // Check if spawning is complete
     if (_monstersSpawned >= _monstersToSpawn)
@@ -32,11 +32,17 @@ void MonsterSpawnerSystem::update(float deltaTime, int &currentLevel, engine::Re
     // Update spawn timer
     _spawnTimer += deltaTime;
     
-    // Spawn monsters at intervals from config
-    if (_spawnTimer >= _config.gameplay.monsterSpawnDelay) {
+    // Spawn monsters at intervals from config; LevelSystem runs decimated, so several
+    // spawns can be due at once and the overshoot carries over to keep the cadence
+    const float spawnDelay = _config.gameplay.monsterSpawnDelay;
+    while (_spawnTimer >= spawnDelay && _monstersSpawned < _monstersToSpawn) {
         spawnMonster(registry);
-        _spawnTimer = 0.0f;
         _monstersSpawned++;
+        if (spawnDelay <= 0.0f) {
+            _spawnTimer = 0.0f;
+            break;
+        }
+        _spawnTimer -= spawnDelay;
     }
 }
 
@@ -126,7 +132,7 @@ LevelSystem::LevelSystem(
     : ISystem(config),  _spawner(config), _waveChanged(false)
 {}
 
-void LevelSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDelete)
+void LevelSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDelete)
 {
     // if (currentLevel == 0) {
     //     startWave(1, currentLevel, registry);
@@ -179,6 +185,12 @@ void LevelSystem::startWave(int waveNumber, int &currentLevel, engine::Registry
     _spawner.startSpawning(monstersToSpawn);
 }
 
+engine::SystemRate LevelSystem::rate() const
+{
+    // Wave checks scan every monster; 10 Hz is plenty for spawning and wave changes
+    return engine::SystemRate::every(6);
+}
+
 bool LevelSystem::isWaveComplete(engine::Registry &registry) const
 {
     // Check if there are any living monsters
@@ -7,20 +7,56 @@
 
 #include "rtype/server/systems/MovementSystem.hpp"
 #include "rtype/common/Components.hpp"
+#include "rtype/engine/SimdKernels.hpp"
 
 namespace rtype::server
 {
 
+// Both packed arrays are walked as plain float lanes
+static_assert(sizeof(Transform) == 2 * sizeof(float) && sizeof(Velocity) == 2 * sizeof(float),
+              "MovementSystem integrates Transform and Velocity as {x, y} float pairs");
+
 // MovementSystem
-void MovementSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &)
+void MovementSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &)
 {
-    registry.forEach<Transform>([&](EntityId id, Transform &transform) {
-        auto *velocity = registry.getComponent<Velocity>(id);
-        if (velocity) {
-            transform.x += velocity->vx * deltaTime;
-            transform.y += velocity->vy * deltaTime;
+    auto &bodies = registry.group<Transform, Velocity>();
+    if (bodies.size() == 0)
+        return;
+
+    Transform *transforms = bodies.raw<Transform>();
+    const Velocity *velocities = bodies.raw<Velocity>();
+    const EntityId *entities = bodies.entities();
+    engine::JobSystem *jobs = registry.jobSystem();
+
+    _moved.resize(jobs ? jobs->maxChunks() : 1);
+    for (auto &chunk : _moved)
+        chunk.clear();
+
+    const auto integrateChunk = [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+        engine::integrate(&transforms[begin].x, &velocities[begin].vx, (end - begin) * 2, deltaTime);
+
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            if (velocities[i].vx != 0.0f || velocities[i].vy != 0.0f)
+                _moved[chunk].push_back(entities[i]);
         }
-    });
+    };
+
+    if (jobs)
+        jobs->parallelFor(0, bodies.size(), engine::Registry::kParallelGrain, integrateChunk);
+    else
+        integrateChunk(0, bodies.size(), 0);
+
+    // Only entities that actually moved are re-sent to clients
+    for (const auto &chunk : _moved)
+        registry.markChanged<Transform>(chunk);
 }
 
-}
\ No newline at end of file
+engine::SystemAccess MovementSystem::access() const
+{
+    return engine::SystemAccess{}
+        .read<Velocity>()
+        .write<Transform>();
+}
+
+}
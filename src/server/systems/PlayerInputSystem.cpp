@@ -11,13 +11,13 @@
 namespace rtype::server {
 
 
-void PlayerInputSystem::update(float dt, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &)
+void PlayerInputSystem::update(float dt, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &)
 {
-    registry.view<PlayerInputComponent, Velocity, PlayerPowerUpStatus>([&](
+    registry.group<PlayerPowerUpStatus>(engine::observe<PlayerInputComponent, Velocity>).each([&](
         EntityId id,
+        PlayerPowerUpStatus &powerUpStatus,
         PlayerInputComponent &input,
-        Velocity &vel,
-        PlayerPowerUpStatus &powerUpStatus)
+        Velocity &vel)
     {
         vel.vx = 0.f;
         vel.vy = 0.f;
@@ -37,7 +37,16 @@ void PlayerInputSystem::update(float dt, int &currentLevel, engine::Registry &re
         if (powerUpStatus.type != PlayerPowerUpType::Nothing
             && std::chrono::steady_clock::now() - powerUpStatus.start_time > std::chrono::seconds((_config.gameplay.shieldDuration))) {
             powerUpStatus.type = PlayerPowerUpType::Nothing;
+            registry.markChanged<PlayerPowerUpStatus>(id);
         }
     });
 }
+
+engine::SystemAccess PlayerInputSystem::access() const
+{
+    return engine::SystemAccess{}
+        .read<PlayerInputComponent>()
+        .write<PlayerPowerUpStatus, Velocity>();
+}
+
 }
\ No newline at end of file
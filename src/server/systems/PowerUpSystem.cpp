@@ -9,10 +9,11 @@
 #include <random>
 #include <algorithm>
 #include "rtype/server/EntityFactory.hpp"
+#include "rtype/engine/SpatialIndex.hpp"
 #include <iostream>
 #include <random>
 namespace rtype::server {
-void PowerUpSystem::update(float dt, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy)
+void PowerUpSystem::update(float dt, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy)
 {
     _powerUpSpawnTimer += dt;
     if (_config.gameplay.powerUpsEnabled && _powerUpSpawnTimer >= _config.gameplay.powerUpSpawnDelay)
@@ -48,6 +49,10 @@ void PowerUpSystem::update(float dt, int &currentLevel, engine::Registry &regist
         std::cout << "[server] Spawned powerup id_type : " << power_up_types << " at (" << spawnX << ", " << spawnY << ")" << std::endl;
     }
 
+    // [CollisionLayers] Player=... decides whether players collect power-ups at all
+    const engine::SpatialIndex *index = registry.spatialIndex();
+    const bool pickups = index && _config.systems.collisionLayers.collides(CollisionLayer::Player, CollisionLayer::PowerUp);
+
     registry.view<PowerUp, Transform>([&](EntityId powerUpId, PowerUp &powerUp, Transform &powerUpTransform) {
 
         const float powerMargin = _config.gameplay.powerUpBoundaryMargin;
@@ -56,56 +61,48 @@ void PowerUpSystem::update(float dt, int &currentLevel, engine::Registry &regist
             powerUpTransform.y < -powerMargin ||
             powerUpTransform.y > _config.gameplay.worldHeight + powerMargin)
         {
-            toDestroy.insert(powerUpId);
+            toDestroy.mark(powerUpId);
             return;
         }
 
-        registry.each<PlayerComponent>([&](EntityId playerId, [[maybe_unused]] PlayerComponent &player) {
-            if (toDestroy.count(powerUpId) > 0)
-                return;
-            
-            auto *playerTransform = registry.get<Transform>(playerId);
-            if (!playerTransform)
+        if (!pickups)
+            return;
+
+        auto *powerUpCollider = registry.get<Collider>(powerUpId);
+        const float powerUpRadius = powerUpCollider ? powerUpCollider->radius : 8.0f;
+
+        // Players whose collider touches the power-up, from this tick's index
+        index->queryRadius(powerUpTransform.x, powerUpTransform.y, powerUpRadius, [&](EntityId playerId) {
+            if (toDestroy.contains(powerUpId) || !registry.get<PlayerComponent>(playerId))
                 return;
-            
-            auto *playerCollider = registry.get<Collider>(playerId);
-            auto *powerUpCollider = registry.get<Collider>(powerUpId);
-            const float playerRadius = playerCollider ? playerCollider->radius : 10.0f;
-            const float powerUpRadius = powerUpCollider ? powerUpCollider->radius : 8.0f;
-            const float combinedRadius = playerRadius + powerUpRadius;
-            
-            const float dx = playerTransform->x - powerUpTransform.x;
-            const float dy = playerTransform->y - powerUpTransform.y;
-            if ((dx * dx + dy * dy) < combinedRadius * combinedRadius)
-            {
-                switch (static_cast<PowerUpTypes>(powerUp.type)) {
-                    case PowerUpTypes::WeaponUpgrade: {
-                        auto *weapon = registry.get<WeaponComponent>(playerId);
-                        if (!weapon)
-                            weapon = &registry.emplace<WeaponComponent>(playerId, WeaponComponent{});
-
-                        const bool hadLaser = weapon->laserUnlocked;
-
-                        incrementPowerUpProgress(*weapon);
-
-                        if (weapon->laserUnlocked && hadLaser && weapon->weaponType == WeaponType::kWeaponLaserType)
-                        {
-                            if (weapon->weaponLevel < 3)
-                                weapon->weaponLevel++;
-                        }
-                        break;
-                    }
-                    case PowerUpTypes::Shield: {
-                        auto *power_up_status = registry.get<PlayerPowerUpStatus>(playerId);
-                        power_up_status->type = PlayerPowerUpType::Shield;
-                        power_up_status->start_time = std::chrono::steady_clock::now();
-                        break;
+
+            switch (static_cast<PowerUpTypes>(powerUp.type)) {
+                case PowerUpTypes::WeaponUpgrade: {
+                    auto *weapon = registry.get<WeaponComponent>(playerId);
+                    if (!weapon)
+                        weapon = &registry.emplace<WeaponComponent>(playerId, WeaponComponent{});
+
+                    const bool hadLaser = weapon->laserUnlocked;
+
+                    incrementPowerUpProgress(*weapon);
+
+                    if (weapon->laserUnlocked && hadLaser && weapon->weaponType == WeaponType::kWeaponLaserType)
+                    {
+                        if (weapon->weaponLevel < 3)
+                            weapon->weaponLevel++;
                     }
-                    default:
-                        break;
+                    break;
+                }
+                case PowerUpTypes::Shield: {
+                    auto *power_up_status = registry.patch<PlayerPowerUpStatus>(playerId);
+                    power_up_status->type = PlayerPowerUpType::Shield;
+                    power_up_status->start_time = std::chrono::steady_clock::now();
+                    break;
                 }
-                toDestroy.insert(powerUpId);
+                default:
+                    break;
             }
+            toDestroy.mark(powerUpId);
         });
     });
 }
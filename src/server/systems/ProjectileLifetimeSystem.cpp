@@ -16,7 +16,7 @@ namespace rtype::server
 ProjectileLifetimeSystem::ProjectileLifetimeSystem(const config::GameConfig &config)
     : ISystem(config), _maxLifetime(config.gameplay.bulletLifetime){}
 
-void ProjectileLifetimeSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &destroySet)
+void ProjectileLifetimeSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &destroySet)
 {
     registry.forEach<Projectile>([&](EntityId id, Projectile &projectile) {
         if (projectile.persistent)
@@ -24,9 +24,16 @@ void ProjectileLifetimeSystem::update(float deltaTime, int &currentLevel, engine
         projectile.lifetime += deltaTime;
         
         if (projectile.lifetime > _maxLifetime) {
-            destroySet.insert(id);
+            destroySet.mark(id);
         }
     });
 }
 
+engine::SystemAccess ProjectileLifetimeSystem::access() const
+{
+    return engine::SystemAccess{}
+        .write<Projectile>()
+        .usesDestroyList();
+}
+
 }
\ No newline at end of file
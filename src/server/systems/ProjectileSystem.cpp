@@ -0,0 +1,56 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** ProjectileSystem
+*/
+
+#include "rtype/server/systems/ProjectileSystem.hpp"
+#include "rtype/common/Components.hpp"
+
+namespace rtype::server
+{
+
+ProjectileSystem::ProjectileSystem(const config::GameConfig &config)
+    : ISystem(config),
+      _age(config.systems.projectileLifetimeSystem),
+      _cull(config.systems.boundarySystem),
+      _maxLifetime(config.gameplay.bulletLifetime),
+      _minX(-config.systems.boundaryMargin),
+      _maxX(config.gameplay.worldWidth + config.systems.boundaryMargin),
+      _minY(-config.systems.boundaryMargin),
+      _maxY(config.gameplay.worldHeight + config.systems.boundaryMargin)
+{
+}
+
+void ProjectileSystem::update(float deltaTime, int &, engine::Registry &registry, engine::DestroyQueue &toDestroy)
+{
+    auto &projectiles = registry.group<Projectile>(engine::observe<Transform>);
+
+    projectiles.each([&](EntityId id, Projectile &projectile, const Transform &transform) {
+        // ProjectileLifetimeSystem
+        if (_age && !projectile.persistent)
+        {
+            projectile.lifetime += deltaTime;
+            if (projectile.lifetime > _maxLifetime)
+            {
+                toDestroy.mark(id);
+                return;
+            }
+        }
+
+        // BoundarySystem
+        if (_cull && (transform.x < _minX || transform.x > _maxX || transform.y < _minY || transform.y > _maxY))
+            toDestroy.mark(id);
+    });
+}
+
+engine::SystemAccess ProjectileSystem::access() const
+{
+    return engine::SystemAccess{}
+        .read<Transform>()
+        .write<Projectile>()
+        .usesDestroyList();
+}
+
+}
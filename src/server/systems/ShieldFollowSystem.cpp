@@ -14,17 +14,17 @@ namespace rtype::server
     : engine::ISystem(config)
 {
 }
-void ShieldFollowSystem::update(float deltaTime, int &, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy)
+void ShieldFollowSystem::update(float deltaTime, int &, engine::Registry &registry, engine::DestroyQueue &toDestroy)
 {
     // Update shield positions to follow parent monsters
     registry.forEach<ShieldComponent>([&](EntityId shieldId, ShieldComponent &shieldComp) {
-        auto *shieldTransform = registry.get<Transform>(shieldId);
+        auto *shieldTransform = registry.patch<Transform>(shieldId);
         if (!shieldTransform)
             return;
         
-        // Check if parent monster is marked for destruction
-        if (toDestroy.count(shieldComp.parentMonster) > 0) {
-            toDestroy.insert(shieldId);
+        // Check if parent monster is gone (stale handle) or marked for destruction
+        if (!registry.entityExists(shieldComp.parentMonster) || toDestroy.contains(shieldComp.parentMonster)) {
+            toDestroy.mark(shieldId);
             return;
         }
         
@@ -34,7 +34,7 @@ void ShieldFollowSystem::update(float deltaTime, int &, engine::Registry &regist
         
         if (!parentTransform || !parentHealth || !parentHealth->alive) {
             // Parent is dead or doesn't exist, destroy shield
-            toDestroy.insert(shieldId);
+            toDestroy.mark(shieldId);
             return;
         }
         
@@ -88,8 +88,17 @@ void ShieldFollowSystem::update(float deltaTime, int &, engine::Registry &regist
         // Check if shield is destroyed
         auto *shieldHealth = registry.get<Health>(shieldId);
         if (shieldHealth && !shieldHealth->alive) {
-            toDestroy.insert(shieldId);
+            toDestroy.mark(shieldId);
         }
     });
 }
+
+engine::SystemAccess ShieldFollowSystem::access() const
+{
+    return engine::SystemAccess{}
+        .read<ShieldComponent, Health, MonsterComponent>()
+        .write<Transform, Velocity>()
+        .usesDestroyList();
+}
+
 }
\ No newline at end of file
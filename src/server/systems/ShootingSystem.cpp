@@ -42,15 +42,11 @@ void ShootingSystem::startLaserBeam(EntityId entity, WeaponComponent &weapon, Pl
 
     
     EntityFactory entityfactory(registry, _config);
+    // spawnBullet already makes laser projectiles persistent; the beam's
+    // components only land in the registry once the group iteration ends
     EntityId beamId = entityfactory.spawnBullet(entity, true, startX, startY,
                                                   0.0f, 0.0f, weapon.weaponType, damage);
 
-    if (auto *projectile = registry.get<Projectile>(beamId)) {
-        projectile->persistent = true;
-        projectile->lifetime = 0.0f;
-        projectile->damageTickTimer = 0.0f;
-    }
-
     weapon.laserActive = true;
     weapon.activeLaserId = beamId;
 
@@ -58,7 +54,7 @@ void ShootingSystem::startLaserBeam(EntityId entity, WeaponComponent &weapon, Pl
 }
 
 
-void ShootingSystem::handleLaserFireInput(EntityId entity, WeaponComponent &weapon, PlayerComponent &player, FireCooldown &cooldown, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroySet)
+void ShootingSystem::handleLaserFireInput(EntityId entity, WeaponComponent &weapon, PlayerComponent &player, FireCooldown &cooldown, engine::Registry &registry, engine::DestroyQueue &toDestroySet)
 {
     if (!weapon.laserActive)
         startLaserBeam(entity, weapon, player, cooldown, registry);
@@ -149,7 +145,7 @@ void ShootingSystem::shootProjectile(WeaponComponent &weapon, const EntityId ent
     entityfactory.spawnBullet(entity, true, startX, startY, bulletVx, bulletVy, weaponType, damage);
 }
 
-void ShootingSystem::stopActiveLaser(WeaponComponent &weapon, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroySet)
+void ShootingSystem::stopActiveLaser(WeaponComponent &weapon, engine::Registry &registry, engine::DestroyQueue &toDestroySet)
 {
     constexpr float kLaserReleaseFadeDuration = 0.18f;
     if (weapon.activeLaserId != 0) {
@@ -165,7 +161,7 @@ void ShootingSystem::stopActiveLaser(WeaponComponent &weapon, engine::Registry &
         }
 
         if (!scheduledFade || !_config.systems.projectileLifetimeSystem)
-            toDestroySet.insert(weapon.activeLaserId);
+            toDestroySet.mark(weapon.activeLaserId);
     }
     weapon.activeLaserId = 0;
     weapon.laserActive = false;
@@ -195,9 +191,9 @@ void ShootingSystem::cycleEquippedWeapon(WeaponComponent &weapon)
 
 
 
-void ShootingSystem::update(float dt, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroySet)
+void ShootingSystem::update(float dt, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroySet)
 {
-    registry.view<PlayerInputComponent, WeaponComponent, FireCooldown>([&](
+    registry.group<PlayerInputComponent, WeaponComponent, FireCooldown>().each([&](
         EntityId entity,
         PlayerInputComponent &input,
         WeaponComponent &weapon,
@@ -236,7 +232,7 @@ void ShootingSystem::update(float dt, int &currentLevel, engine::Registry &regis
                 cooldown.timer = cooldown.cooldownTime;
             }
         });
-    registry.view<AutomaticShooting, WeaponComponent, FireCooldown>([&](
+    registry.group<AutomaticShooting>(engine::observe<WeaponComponent, FireCooldown>).each([&](
         EntityId entity,
         AutomaticShooting &shooting,
         WeaponComponent &weapon,
@@ -244,7 +240,10 @@ void ShootingSystem::update(float dt, int &currentLevel, engine::Registry &regis
 
             if (cooldown.timer <= 0.0f)
             {
-                auto *monsterTransform = registry.get<Transform>(entity);
+                // Copy the position so it stays valid whatever the spawns do
+                const auto *monsterTransform = registry.get<Transform>(entity);
+                const bool hasOrigin = monsterTransform != nullptr;
+                const Transform origin = hasOrigin ? *monsterTransform : Transform{};
                 EntityFactory entityfactory(registry, _config);
                 
                 // Adjust spawn offset based on shooting direction
@@ -260,8 +259,8 @@ void ShootingSystem::update(float dt, int &currentLevel, engine::Registry &regis
                         offsetY = -offsetY;  // Flip Y offset for up-shooting monsters
                     }
                     
-                    const float startX = monsterTransform ? monsterTransform->x + offsetX : 0.0f;
-                    const float startY = monsterTransform ? monsterTransform->y + offsetY : 0.0f;
+                    const float startX = hasOrigin ? origin.x + offsetX : 0.0f;
+                    const float startY = hasOrigin ? origin.y + offsetY : 0.0f;
 
                     entityfactory.spawnBullet(entity, false, startX, startY, direction.dx, direction.dy, WeaponType::kWeaponBasicType, 1);
                 }
@@ -0,0 +1,40 @@
+/*
+** EPITECH PROJECT, 2026
+** rtype
+** File description:
+** SpatialIndexSystem
+*/
+
+#include "rtype/server/systems/SpatialIndexSystem.hpp"
+#include "rtype/common/Components.hpp"
+
+namespace rtype::server
+{
+
+SpatialIndexSystem::SpatialIndexSystem(const config::GameConfig &config)
+    : ISystem(config), _world{0.0f, 0.0f, config.gameplay.worldWidth, config.gameplay.worldHeight},
+      _pickups(config.systems.collisionLayers.collides(CollisionLayer::Player, CollisionLayer::PowerUp))
+{
+}
+
+void SpatialIndexSystem::update(float, int &, engine::Registry &registry, engine::DestroyQueue &)
+{
+    // PowerUpSystem pickups are the only reader so far
+    engine::SpatialIndex *index = registry.spatialIndex();
+    if (!index || !_pickups)
+        return;
+
+    registry.view<PlayerComponent, Transform, Collider>([&](EntityId id, PlayerComponent &, Transform &transform, Collider &collider) {
+        index->insert(id, transform.x, transform.y, collider.radius);
+    });
+    index->build(_world);
+}
+
+engine::SystemAccess SpatialIndexSystem::access() const
+{
+    return engine::SystemAccess{}
+        .read<PlayerComponent, Transform, Collider>()
+        .buildsSpatialIndex();
+}
+
+}
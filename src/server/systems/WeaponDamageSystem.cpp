@@ -20,13 +20,13 @@ void WeaponDamageSystem::dealDamage(std::uint8_t damage, Health &health)
 
 
 
-void WeaponDamageSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, std::unordered_set<rtype::EntityId> &toDestroy)
+void WeaponDamageSystem::update(float deltaTime, int &currentLevel, engine::Registry &registry, engine::DestroyQueue &toDestroy)
 {
     registry.forEach<Hurtbox>([&](EntityId id, Hurtbox &hurtbox){
         if (!hurtbox.collidedWith || *hurtbox.collidedWith == id)
             return;
         EntityId projectileId = *(hurtbox.collidedWith);
-        if (toDestroy.count(projectileId) > 0)
+        if (toDestroy.contains(projectileId))
             return;
         auto *projectile = registry.getComponent<Projectile>(projectileId);
         if (!projectile)
@@ -39,7 +39,7 @@ void WeaponDamageSystem::update(float deltaTime, int &currentLevel, engine::Regi
             if (projectile->damageTickTimer < laserDamageInterval || !projectile->persistent)
                 return;
 
-            auto *health = registry.get<Health>(id);
+            auto *health = registry.patch<Health>(id);
             if (!health || !health->alive)
                 return;
 
@@ -48,12 +48,12 @@ void WeaponDamageSystem::update(float deltaTime, int &currentLevel, engine::Regi
             projectile->damageTickTimer = 0.0f;
 
             if (!health->alive)
-                toDestroy.insert(id);
+                toDestroy.mark(id);
         } else {
-            if (toDestroy.count(id) > 0)
+            if (toDestroy.contains(id))
                 return;
 
-            auto *health = registry.get<Health>(id);
+            auto *health = registry.patch<Health>(id);
             if (!health || !health->alive)
                 return;
 
@@ -67,12 +67,20 @@ void WeaponDamageSystem::update(float deltaTime, int &currentLevel, engine::Regi
             dealDamage(projectile->damage, *health);
 
             if (!health->alive)
-                toDestroy.insert(id);
+                toDestroy.mark(id);
             }
     hurtbox.collidedWith = std::nullopt;
     });
 }
 
+engine::SystemAccess WeaponDamageSystem::access() const
+{
+    return engine::SystemAccess{}
+        .read<PlayerPowerUpStatus>()
+        .write<Hurtbox, Projectile, Health>()
+        .usesDestroyList();
+}
+
 
 
 }
\ No newline at end of file